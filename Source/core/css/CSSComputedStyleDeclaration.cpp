@@ -120,6 +120,7 @@ static const CSSPropertyID staticComputableProperties[] = {
     CSSPropertyClear,
     CSSPropertyClip,
     CSSPropertyColor,
+    CSSPropertyContentSkipping,
     CSSPropertyCursor,
     CSSPropertyDirection,
     CSSPropertyDisplay,
@@ -2158,6 +2159,12 @@ PassRefPtrWillBeRawPtr<CSSValue> CSSComputedStyleDeclaration::getPropertyCSSValu
             return cssValuePool().createValue(style->rubyPosition());
         case CSSPropertyScrollBehavior:
             return cssValuePool().createValue(style->scrollBehavior());
+        case CSSPropertyContentSkipping: {
+            const Length& contentSkipping = style->contentSkipping();
+            if (contentSkipping.isMaxSizeNone())
+                return cssValuePool().createIdentifierValue(CSSValueNone);
+            return zoomAdjustedPixelValueForLength(contentSkipping, *style);
+        }
         case CSSPropertyTableLayout:
             return cssValuePool().createValue(style->tableLayout());
         case CSSPropertyTextAlign:
@@ -0,0 +1,35 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/css/CSSComputedStyleDeclaration.h"
+
+#include "core/dom/Document.h"
+#include "core/html/HTMLElement.h"
+#include "core/testing/DummyPageHolder.h"
+#include "platform/RuntimeEnabledFeatures.h"
+#include <gtest/gtest.h>
+
+using namespace blink;
+
+namespace {
+
+TEST(CSSComputedStyleDeclarationTest, ContentSkipping)
+{
+    bool contentSkippingEnabled = RuntimeEnabledFeatures::cssContentSkippingEnabled();
+    RuntimeEnabledFeatures::setCSSContentSkippingEnabled(true);
+
+    OwnPtr<DummyPageHolder> dummyPageHolder = DummyPageHolder::create(IntSize(800, 600));
+    Document& document = dummyPageHolder->document();
+    document.body()->setInnerHTML("<div id='none'></div><div id='length' style='content-skipping: 100px'></div>", ASSERT_NO_EXCEPTION);
+
+    RefPtrWillBeRawPtr<CSSComputedStyleDeclaration> none = CSSComputedStyleDeclaration::create(document.getElementById("none"));
+    EXPECT_EQ("none", none->getPropertyValue(CSSPropertyContentSkipping));
+    RefPtrWillBeRawPtr<CSSComputedStyleDeclaration> length = CSSComputedStyleDeclaration::create(document.getElementById("length"));
+    EXPECT_EQ("100px", length->getPropertyValue(CSSPropertyContentSkipping));
+
+    RuntimeEnabledFeatures::setCSSContentSkippingEnabled(contentSkippingEnabled);
+}
+
+} // namespace
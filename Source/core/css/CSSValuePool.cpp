@@ -29,11 +29,17 @@
 #include "core/css/CSSValueList.h"
 #include "core/css/parser/CSSParser.h"
 #include "core/rendering/style/RenderStyle.h"
+#include "public/platform/Platform.h"
+#include "wtf/MainThread.h"
+#include "wtf/StdLibExtras.h"
 
 namespace blink {
 
+// The pool and the values in it are not thread safe, as CSSValue is not thread-safe
+// ref counted. All CSS parsing that reaches here happens on the main thread.
 CSSValuePool& cssValuePool()
 {
+    ASSERT(isMainThread());
     DEFINE_STATIC_LOCAL(OwnPtrWillBePersistent<CSSValuePool>, pool, (adoptPtrWillBeNoop(new CSSValuePool())));
     return *pool;
 }
@@ -45,6 +51,7 @@ CSSValuePool::CSSValuePool()
     , m_colorTransparent(CSSPrimitiveValue::createColor(Color::transparent))
     , m_colorWhite(CSSPrimitiveValue::createColor(Color::white))
     , m_colorBlack(CSSPrimitiveValue::createColor(Color::black))
+    , m_sharedValueCount(0)
 {
     m_identifierValueCache.resize(numCSSValueKeywords);
     m_pixelValueCache.resize(maximumCacheableIntegerValue + 1);
@@ -95,29 +102,70 @@ PassRefPtrWillBeRawPtr<CSSPrimitiveValue> CSSValuePool::createValue(double value
     if (std::isinf(value))
         value = 0;
 
-    if (value < 0 || value > maximumCacheableIntegerValue)
-        return CSSPrimitiveValue::create(value, type);
-
     int intValue = static_cast<int>(value);
-    if (value != intValue)
-        return CSSPrimitiveValue::create(value, type);
+    if (value >= 0 && value <= maximumCacheableIntegerValue && value == intValue) {
+        switch (type) {
+        case CSSPrimitiveValue::CSS_PX:
+            if (!m_pixelValueCache[intValue])
+                m_pixelValueCache[intValue] = CSSPrimitiveValue::create(value, type);
+            return m_pixelValueCache[intValue];
+        case CSSPrimitiveValue::CSS_PERCENTAGE:
+            if (!m_percentValueCache[intValue])
+                m_percentValueCache[intValue] = CSSPrimitiveValue::create(value, type);
+            return m_percentValueCache[intValue];
+        case CSSPrimitiveValue::CSS_NUMBER:
+            if (!m_numberValueCache[intValue])
+                m_numberValueCache[intValue] = CSSPrimitiveValue::create(value, type);
+            return m_numberValueCache[intValue];
+        default:
+            break;
+        }
+    }
+
+    // Just wipe out the cache and start rebuilding if it gets too big.
+    const unsigned maximumNumericCacheSize = 1024;
+    if (m_numericValueCache.size() > maximumNumericCacheSize)
+        m_numericValueCache.clear();
+
+    ASSERT(type != CSSPrimitiveValue::CSS_UNKNOWN);
+    NumericValueKey key(type, bitwise_cast<unsigned long long>(value));
+    RefPtrWillBeMember<CSSPrimitiveValue>& cachedValue = m_numericValueCache.add(key, nullptr).storedValue->value;
+    if (!cachedValue) {
+        cachedValue = CSSPrimitiveValue::create(value, type);
+        return cachedValue;
+    }
+    return sharedValue(cachedValue.get());
+}
 
-    switch (type) {
-    case CSSPrimitiveValue::CSS_PX:
-        if (!m_pixelValueCache[intValue])
-            m_pixelValueCache[intValue] = CSSPrimitiveValue::create(value, type);
-        return m_pixelValueCache[intValue];
-    case CSSPrimitiveValue::CSS_PERCENTAGE:
-        if (!m_percentValueCache[intValue])
-            m_percentValueCache[intValue] = CSSPrimitiveValue::create(value, type);
-        return m_percentValueCache[intValue];
-    case CSSPrimitiveValue::CSS_NUMBER:
-        if (!m_numberValueCache[intValue])
-            m_numberValueCache[intValue] = CSSPrimitiveValue::create(value, type);
-        return m_numberValueCache[intValue];
-    default:
+PassRefPtrWillBeRawPtr<CSSPrimitiveValue> CSSValuePool::createParsedStringValue(const String& value, CSSPrimitiveValue::UnitType type)
+{
+    // Long strings rarely repeat, and would be kept alive by the cache.
+    const unsigned maximumCacheableStringLength = 256;
+    StringValueCache* cache = 0;
+    if (type == CSSPrimitiveValue::CSS_STRING)
+        cache = &m_stringValueCache;
+    else if (type == CSSPrimitiveValue::CSS_URI)
+        cache = &m_uriValueCache;
+    if (!cache || value.isNull() || value.length() > maximumCacheableStringLength)
         return CSSPrimitiveValue::create(value, type);
+
+    // Just wipe out the cache and start rebuilding if it gets too big.
+    const unsigned maximumStringCacheSize = 512;
+    if (cache->size() > maximumStringCacheSize)
+        cache->clear();
+
+    RefPtrWillBeMember<CSSPrimitiveValue>& cachedValue = cache->add(value, nullptr).storedValue->value;
+    if (!cachedValue) {
+        cachedValue = CSSPrimitiveValue::create(value, type);
+        return cachedValue;
     }
+    return sharedValue(cachedValue.get());
+}
+
+void CSSValuePool::recordSharedValueCountForSheet(unsigned sharedValueCount)
+{
+    unsigned kilobytesSaved = sharedValueCount * sizeof(CSSPrimitiveValue) / 1024;
+    blink::Platform::current()->histogramCustomCounts("Style.CSSValuePool.KilobytesSavedPerSheet", kilobytesSaved, 1, 10000, 50);
 }
 
 PassRefPtrWillBeRawPtr<CSSPrimitiveValue> CSSValuePool::createValue(const Length& value, const RenderStyle& style)
@@ -163,6 +211,9 @@ void CSSValuePool::trace(Visitor* visitor)
     visitor->trace(m_pixelValueCache);
     visitor->trace(m_percentValueCache);
     visitor->trace(m_numberValueCache);
+    visitor->trace(m_numericValueCache);
+    visitor->trace(m_stringValueCache);
+    visitor->trace(m_uriValueCache);
     visitor->trace(m_fontFaceValueCache);
     visitor->trace(m_fontFamilyValueCache);
 #endif
@@ -56,11 +56,26 @@ public:
     PassRefPtrWillBeRawPtr<CSSPrimitiveValue> createValue(const Length& value, float zoom) { return CSSPrimitiveValue::create(value, zoom); }
     template<typename T> static PassRefPtrWillBeRawPtr<CSSPrimitiveValue> createValue(T value) { return CSSPrimitiveValue::create(value); }
 
+    // Strings and URIs repeat across the rules of a sheet, unlike the values of computed
+    // style, so only the parser shares them.
+    PassRefPtrWillBeRawPtr<CSSPrimitiveValue> createParsedStringValue(const String& value, CSSPrimitiveValue::UnitType);
+
+    // Number of values returned from the numeric and string caches instead of being
+    // allocated. The identifier, color and small integer caches are not counted.
+    unsigned sharedValueCount() const { return m_sharedValueCount; }
+    static void recordSharedValueCountForSheet(unsigned sharedValueCount);
+
     void trace(Visitor*);
 
 private:
     CSSValuePool();
 
+    PassRefPtrWillBeRawPtr<CSSPrimitiveValue> sharedValue(CSSPrimitiveValue* value)
+    {
+        ++m_sharedValueCount;
+        return value;
+    }
+
     RefPtrWillBeMember<CSSInheritedValue> m_inheritedValue;
     RefPtrWillBeMember<CSSInitialValue> m_implicitInitialValue;
     RefPtrWillBeMember<CSSInitialValue> m_explicitInitialValue;
@@ -79,6 +94,18 @@ private:
     WillBeHeapVector<RefPtrWillBeMember<CSSPrimitiveValue>, maximumCacheableIntegerValue + 1> m_percentValueCache;
     WillBeHeapVector<RefPtrWillBeMember<CSSPrimitiveValue>, maximumCacheableIntegerValue + 1> m_numberValueCache;
 
+    // Numbers in any other unit, or not a small integer, keyed by unit and the bits of the value.
+    typedef std::pair<unsigned, unsigned long long> NumericValueKey;
+    typedef WillBeHeapHashMap<NumericValueKey, RefPtrWillBeMember<CSSPrimitiveValue> > NumericValueCache;
+    NumericValueCache m_numericValueCache;
+
+    // Short strings and URIs, which repeat in content, quotes and SVG references.
+    typedef WillBeHeapHashMap<String, RefPtrWillBeMember<CSSPrimitiveValue> > StringValueCache;
+    StringValueCache m_stringValueCache;
+    StringValueCache m_uriValueCache;
+
+    unsigned m_sharedValueCount;
+
     typedef WillBeHeapHashMap<AtomicString, RefPtrWillBeMember<CSSValueList> > FontFaceValueCache;
     FontFaceValueCache m_fontFaceValueCache;
 
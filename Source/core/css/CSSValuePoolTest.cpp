@@ -0,0 +1,71 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/css/CSSValuePool.h"
+
+#include "core/css/CSSPrimitiveValue.h"
+#include "wtf/text/StringBuilder.h"
+#include <gtest/gtest.h>
+
+using namespace blink;
+
+namespace {
+
+TEST(CSSValuePoolTest, NumericValuesAreSharedAndCounted)
+{
+    RefPtrWillBeRawPtr<CSSPrimitiveValue> first = cssValuePool().createValue(1.5, CSSPrimitiveValue::CSS_EMS);
+    unsigned sharedValueCount = cssValuePool().sharedValueCount();
+    RefPtrWillBeRawPtr<CSSPrimitiveValue> second = cssValuePool().createValue(1.5, CSSPrimitiveValue::CSS_EMS);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(sharedValueCount + 1, cssValuePool().sharedValueCount());
+
+    RefPtrWillBeRawPtr<CSSPrimitiveValue> other = cssValuePool().createValue(1.5, CSSPrimitiveValue::CSS_REMS);
+    EXPECT_NE(first, other);
+}
+
+TEST(CSSValuePoolTest, PreexistingCachesAreNotCounted)
+{
+    cssValuePool().createValue(10, CSSPrimitiveValue::CSS_PX);
+    cssValuePool().createIdentifierValue(CSSValueAuto);
+    cssValuePool().createColorValue(Color::black);
+
+    unsigned sharedValueCount = cssValuePool().sharedValueCount();
+    EXPECT_EQ(cssValuePool().createValue(10, CSSPrimitiveValue::CSS_PX), cssValuePool().createValue(10, CSSPrimitiveValue::CSS_PX));
+    EXPECT_EQ(cssValuePool().createIdentifierValue(CSSValueAuto), cssValuePool().createIdentifierValue(CSSValueAuto));
+    EXPECT_EQ(cssValuePool().createColorValue(Color::black), cssValuePool().createColorValue(Color::black));
+    EXPECT_EQ(sharedValueCount, cssValuePool().sharedValueCount());
+}
+
+TEST(CSSValuePoolTest, OnlyParsedStringsAreShared)
+{
+    unsigned sharedValueCount = cssValuePool().sharedValueCount();
+    RefPtrWillBeRawPtr<CSSPrimitiveValue> computed = cssValuePool().createValue("a", CSSPrimitiveValue::CSS_STRING);
+    EXPECT_NE(computed, cssValuePool().createValue("a", CSSPrimitiveValue::CSS_STRING));
+    EXPECT_EQ(sharedValueCount, cssValuePool().sharedValueCount());
+
+    RefPtrWillBeRawPtr<CSSPrimitiveValue> parsed = cssValuePool().createParsedStringValue("a", CSSPrimitiveValue::CSS_STRING);
+    sharedValueCount = cssValuePool().sharedValueCount();
+    EXPECT_EQ(parsed, cssValuePool().createParsedStringValue("a", CSSPrimitiveValue::CSS_STRING));
+    EXPECT_EQ(sharedValueCount + 1, cssValuePool().sharedValueCount());
+
+    RefPtrWillBeRawPtr<CSSPrimitiveValue> uri = cssValuePool().createParsedStringValue("a", CSSPrimitiveValue::CSS_URI);
+    EXPECT_NE(parsed, uri);
+    EXPECT_EQ(uri, cssValuePool().createParsedStringValue("a", CSSPrimitiveValue::CSS_URI));
+}
+
+TEST(CSSValuePoolTest, LongParsedStringsAreNotShared)
+{
+    StringBuilder builder;
+    for (unsigned i = 0; i <= 256; ++i)
+        builder.append('a');
+    String longString = builder.toString();
+
+    unsigned sharedValueCount = cssValuePool().sharedValueCount();
+    RefPtrWillBeRawPtr<CSSPrimitiveValue> first = cssValuePool().createParsedStringValue(longString, CSSPrimitiveValue::CSS_STRING);
+    EXPECT_NE(first, cssValuePool().createParsedStringValue(longString, CSSPrimitiveValue::CSS_STRING));
+    EXPECT_EQ(sharedValueCount, cssValuePool().sharedValueCount());
+}
+
+} // namespace
@@ -170,9 +170,29 @@ void ElementRuleCollector::collectMatchingRules(const MatchRequest& matchRequest
     if (SelectorChecker::matchesFocusPseudoClass(element))
         collectMatchingRulesForList(matchRequest.ruleSet->focusPseudoClassRules(), contextFlags, cascadeScope, cascadeOrder, matchRequest, ruleRange);
     collectMatchingRulesForList(matchRequest.ruleSet->tagRules(element.localName()), contextFlags, cascadeScope, cascadeOrder, matchRequest, ruleRange);
+    if (matchRequest.ruleSet->hasAttributeRules())
+        collectMatchingRulesForAttributes(matchRequest, ruleRange, contextFlags, cascadeScope, cascadeOrder);
     collectMatchingRulesForList(matchRequest.ruleSet->universalRules(), contextFlags, cascadeScope, cascadeOrder, matchRequest, ruleRange);
 }
 
+void ElementRuleCollector::collectMatchingRulesForAttributes(const MatchRequest& matchRequest, RuleRange& ruleRange, SelectorChecker::ContextFlags contextFlags, CascadeScope cascadeScope, CascadeOrder cascadeOrder)
+{
+    Element& element = *m_context.element();
+    // Animated SVG attributes may not have been synchronized yet. The style attribute
+    // never gets an attribute bucket, so other elements can skip synchronization.
+    AttributeCollection attributes = element.isSVGElement() ? element.attributes() : element.attributesWithoutUpdate();
+    AttributeCollection::iterator end = attributes.end();
+    for (AttributeCollection::iterator it = attributes.begin(); it != end; ++it) {
+        const AtomicString& localName = it->localName();
+        // Attributes in different namespaces can share a local name, only collect its rules once.
+        bool seenLocalName = false;
+        for (AttributeCollection::iterator previous = attributes.begin(); previous != it && !seenLocalName; ++previous)
+            seenLocalName = previous->localName() == localName;
+        if (!seenLocalName)
+            collectMatchingRulesForList(matchRequest.ruleSet->attributeRules(localName), contextFlags, cascadeScope, cascadeOrder, matchRequest, ruleRange);
+    }
+}
+
 CSSRuleList* ElementRuleCollector::nestedRuleList(CSSRule* rule)
 {
     switch (rule->type()) {
@@ -131,6 +131,7 @@ public:
     void addElementStyleProperties(const StylePropertySet*, bool isCacheable = true);
 
 private:
+    void collectMatchingRulesForAttributes(const MatchRequest&, RuleRange&, SelectorChecker::ContextFlags, CascadeScope, CascadeOrder);
     void collectRuleIfMatches(const RuleData&, SelectorChecker::ContextFlags, CascadeScope, CascadeOrder, const MatchRequest&, RuleRange&);
 
     template<typename RuleDataListType>
@@ -39,6 +39,7 @@
 #include "core/dom/Node.h"
 #include "platform/RuntimeEnabledFeatures.h"
 #include "wtf/BitVector.h"
+#include <limits.h>
 
 namespace blink {
 
@@ -272,7 +273,14 @@ const CSSSelector* RuleFeatureSet::extractInvalidationSetFeatures(const CSSSelec
             return current->tagHistory();
         case CSSSelector::DirectAdjacent:
         case CSSSelector::IndirectAdjacent:
-            features.wholeSubtree = true;
+            // Custom pseudo elements live in the shadow tree of the sibling, so
+            // those still need the sibling subtrees to be recalculated.
+            if (features.customPseudoElement) {
+                features.wholeSubtree = true;
+            } else {
+                features.adjacent = true;
+                features.maxSiblingDistance = current->relation() == CSSSelector::DirectAdjacent ? 1 : UINT_MAX;
+            }
             return current->tagHistory();
         case CSSSelector::Descendant:
         case CSSSelector::Child:
@@ -285,13 +293,31 @@ const CSSSelector* RuleFeatureSet::extractInvalidationSetFeatures(const CSSSelec
 // Add features extracted from the rightmost compound selector to descendant invalidation
 // sets for features found in other compound selectors.
 //
-// Style invalidation is currently supported for descendants only, not for sibling subtrees.
-// We use wholeSubtree invalidation for features found left of adjacent combinators as
-// SubtreeStyleChange will force sibling subtree recalc in
-// ContainerNode::checkForChildrenAdjacentRuleChanges.
+// Features of a compound selector which is only separated from the rightmost one by
+// adjacent combinators, like ".a" in ".a + .b" or ".a ~ .c + .b", go into the sibling
+// invalidation set of its descendant invalidation set instead. Only the siblings which
+// match those features, within the number of adjacent combinators in between, are then
+// invalidated.
 //
-// As we encounter a descendant type of combinator, the features only need to be checked
-// against descendants in the same subtree only. Hence wholeSubtree is reset to false.
+// Once a descendant type of combinator has been crossed, the features only need to be
+// checked against descendants in the same subtree. Hence adjacent is reset to false. For
+// adjacent combinators left of that, like in ".a + .b .c", we use wholeSubtree
+// invalidation, as SubtreeStyleChange will force sibling subtree recalc in
+// ContainerNode::checkForChildrenAdjacentRuleChanges.
+
+void RuleFeatureSet::addFeaturesToInvalidationSet(DescendantInvalidationSet& invalidationSet, const InvalidationSetFeatures& features)
+{
+    if (!features.id.isEmpty())
+        invalidationSet.addId(features.id);
+    if (!features.tagName.isEmpty())
+        invalidationSet.addTagName(features.tagName);
+    for (Vector<AtomicString>::const_iterator it = features.classes.begin(); it != features.classes.end(); ++it)
+        invalidationSet.addClass(*it);
+    for (Vector<AtomicString>::const_iterator it = features.attributes.begin(); it != features.attributes.end(); ++it)
+        invalidationSet.addAttribute(*it);
+    if (features.customPseudoElement)
+        invalidationSet.setCustomPseudoInvalid();
+}
 
 void RuleFeatureSet::addFeaturesToInvalidationSets(const CSSSelector& selector, InvalidationSetFeatures& features)
 {
@@ -299,19 +325,13 @@ void RuleFeatureSet::addFeaturesToInvalidationSets(const CSSSelector& selector,
         if (DescendantInvalidationSet* invalidationSet = invalidationSetForSelector(*current)) {
             if (features.treeBoundaryCrossing)
                 invalidationSet->setTreeBoundaryCrossing();
-            if (features.wholeSubtree) {
+            if (features.adjacent) {
+                addFeaturesToInvalidationSet(invalidationSet->ensureSiblingInvalidationSet(), features);
+                invalidationSet->updateMaxSiblingDistance(features.maxSiblingDistance);
+            } else if (features.wholeSubtree) {
                 invalidationSet->setWholeSubtreeInvalid();
             } else {
-                if (!features.id.isEmpty())
-                    invalidationSet->addId(features.id);
-                if (!features.tagName.isEmpty())
-                    invalidationSet->addTagName(features.tagName);
-                for (Vector<AtomicString>::const_iterator it = features.classes.begin(); it != features.classes.end(); ++it)
-                    invalidationSet->addClass(*it);
-                for (Vector<AtomicString>::const_iterator it = features.attributes.begin(); it != features.attributes.end(); ++it)
-                    invalidationSet->addAttribute(*it);
-                if (features.customPseudoElement)
-                    invalidationSet->setCustomPseudoInvalid();
+                addFeaturesToInvalidationSet(*invalidationSet, features);
             }
         } else {
             if (current->pseudoType() == CSSSelector::PseudoHost)
@@ -329,14 +349,26 @@ void RuleFeatureSet::addFeaturesToInvalidationSets(const CSSSelector& selector,
         case CSSSelector::ShadowDeep:
             features.treeBoundaryCrossing = true;
             features.wholeSubtree = false;
+            features.adjacent = false;
             break;
         case CSSSelector::Descendant:
         case CSSSelector::Child:
             features.wholeSubtree = false;
+            features.adjacent = false;
             break;
         case CSSSelector::DirectAdjacent:
+            if (features.adjacent) {
+                if (features.maxSiblingDistance != UINT_MAX)
+                    ++features.maxSiblingDistance;
+            } else {
+                features.wholeSubtree = true;
+            }
+            break;
         case CSSSelector::IndirectAdjacent:
-            features.wholeSubtree = true;
+            if (features.adjacent)
+                features.maxSiblingDistance = UINT_MAX;
+            else
+                features.wholeSubtree = true;
             break;
         }
     }
@@ -148,6 +148,8 @@ private:
             : customPseudoElement(false)
             , treeBoundaryCrossing(false)
             , wholeSubtree(false)
+            , adjacent(false)
+            , maxSiblingDistance(0)
         { }
         Vector<AtomicString> classes;
         Vector<AtomicString> attributes;
@@ -156,11 +158,16 @@ private:
         bool customPseudoElement;
         bool treeBoundaryCrossing;
         bool wholeSubtree;
+        // True while the features belong to a sibling of the compound selectors
+        // being visited, i.e. no descendant combinator has been crossed yet.
+        bool adjacent;
+        unsigned maxSiblingDistance;
     };
 
     static void extractInvalidationSetFeature(const CSSSelector&, InvalidationSetFeatures&);
     const CSSSelector* extractInvalidationSetFeatures(const CSSSelector&, InvalidationSetFeatures&, bool negated);
     void addFeaturesToInvalidationSets(const CSSSelector&, InvalidationSetFeatures&);
+    static void addFeaturesToInvalidationSet(DescendantInvalidationSet&, const InvalidationSetFeatures&);
 
     void addClassToInvalidationSet(const AtomicString& className, Element&);
 
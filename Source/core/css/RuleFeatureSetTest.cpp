@@ -0,0 +1,109 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/css/RuleFeature.h"
+
+#include "bindings/core/v8/ExceptionStatePlaceholder.h"
+#include "core/HTMLNames.h"
+#include "core/css/CSSSelector.h"
+#include "core/css/CSSTestHelper.h"
+#include "core/css/invalidation/DescendantInvalidationSet.h"
+#include "core/dom/Document.h"
+#include "core/dom/Element.h"
+#include <gtest/gtest.h>
+#include <limits.h>
+
+using namespace blink;
+
+namespace {
+
+class RuleFeatureSetForTesting : public RuleFeatureSet {
+public:
+    DescendantInvalidationSet& classInvalidationSet(const char* className)
+    {
+        CSSSelector selector;
+        selector.setMatch(CSSSelector::Class);
+        selector.setValue(AtomicString(className));
+        return *invalidationSetForSelector(selector);
+    }
+};
+
+class RuleFeatureSetTest : public ::testing::Test {
+protected:
+    virtual void SetUp() OVERRIDE
+    {
+        m_document = Document::create();
+    }
+
+    void collectFeatures(const char* cssText)
+    {
+        CSSTestHelper helper;
+        helper.addCSSRules(cssText);
+        m_features.add(helper.ruleSet().features());
+    }
+
+    DescendantInvalidationSet& classInvalidationSet(const char* className) { return m_features.classInvalidationSet(className); }
+
+    PassRefPtrWillBeRawPtr<Element> createElementWithClass(const char* className)
+    {
+        RefPtrWillBeRawPtr<Element> element = m_document->createElement("div", ASSERT_NO_EXCEPTION);
+        element->setAttribute(HTMLNames::classAttr, className);
+        return element.release();
+    }
+
+private:
+    RefPtrWillBePersistent<Document> m_document;
+    RuleFeatureSetForTesting m_features;
+};
+
+TEST_F(RuleFeatureSetTest, DirectAdjacentGoesIntoSiblingSet)
+{
+    collectFeatures(".a + .b { }");
+
+    DescendantInvalidationSet& invalidationSet = classInvalidationSet("a");
+    EXPECT_FALSE(invalidationSet.wholeSubtreeInvalid());
+    EXPECT_TRUE(invalidationSet.isEmpty());
+    const DescendantInvalidationSet* siblingSet = invalidationSet.siblingInvalidationSet();
+    ASSERT_TRUE(siblingSet);
+    EXPECT_EQ(1u, invalidationSet.maxSiblingDistance());
+    EXPECT_TRUE(siblingSet->invalidatesElement(*createElementWithClass("b")));
+    EXPECT_FALSE(siblingSet->invalidatesElement(*createElementWithClass("c")));
+}
+
+TEST_F(RuleFeatureSetTest, IndirectAdjacentLeftOfDirectAdjacentIsUnbounded)
+{
+    collectFeatures(".a ~ .c + .b { }");
+
+    DescendantInvalidationSet& invalidationSetA = classInvalidationSet("a");
+    EXPECT_FALSE(invalidationSetA.wholeSubtreeInvalid());
+    const DescendantInvalidationSet* siblingSetA = invalidationSetA.siblingInvalidationSet();
+    ASSERT_TRUE(siblingSetA);
+    EXPECT_EQ(static_cast<unsigned>(UINT_MAX), invalidationSetA.maxSiblingDistance());
+    EXPECT_TRUE(siblingSetA->invalidatesElement(*createElementWithClass("b")));
+    EXPECT_FALSE(siblingSetA->invalidatesElement(*createElementWithClass("c")));
+
+    DescendantInvalidationSet& invalidationSetC = classInvalidationSet("c");
+    EXPECT_FALSE(invalidationSetC.wholeSubtreeInvalid());
+    const DescendantInvalidationSet* siblingSetC = invalidationSetC.siblingInvalidationSet();
+    ASSERT_TRUE(siblingSetC);
+    EXPECT_EQ(1u, invalidationSetC.maxSiblingDistance());
+    EXPECT_TRUE(siblingSetC->invalidatesElement(*createElementWithClass("b")));
+}
+
+TEST_F(RuleFeatureSetTest, AdjacentLeftOfDescendantFallsBackToWholeSubtree)
+{
+    collectFeatures(".a + .b .c { }");
+
+    DescendantInvalidationSet& invalidationSetA = classInvalidationSet("a");
+    EXPECT_TRUE(invalidationSetA.wholeSubtreeInvalid());
+    EXPECT_FALSE(invalidationSetA.siblingInvalidationSet());
+
+    DescendantInvalidationSet& invalidationSetB = classInvalidationSet("b");
+    EXPECT_FALSE(invalidationSetB.wholeSubtreeInvalid());
+    EXPECT_FALSE(invalidationSetB.siblingInvalidationSet());
+    EXPECT_TRUE(invalidationSetB.invalidatesElement(*createElementWithClass("c")));
+}
+
+} // namespace
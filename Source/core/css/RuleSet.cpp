@@ -149,8 +149,16 @@ void RuleSet::addToRuleSet(const AtomicString& key, PendingRuleMap& map, const R
     rules->push(ruleData);
 }
 
-static void extractValuesforSelector(const CSSSelector* selector, AtomicString& id, AtomicString& className, AtomicString& customPseudoElementName, AtomicString& tagName)
+static void extractValuesforSelector(const CSSSelector* selector, AtomicString& id, AtomicString& className, AtomicString& customPseudoElementName, AtomicString& tagName, AtomicString& attributeName)
 {
+    if (selector->isAttributeSelector()) {
+        // The style attribute is synchronized lazily, so the element may not list it yet
+        // when rules are collected.
+        if (selector->attribute().localName() != HTMLNames::styleAttr.localName())
+            attributeName = selector->attribute().localName();
+        return;
+    }
+
     switch (selector->match()) {
     case CSSSelector::Id:
         id = selector->value();
@@ -175,6 +183,7 @@ bool RuleSet::findBestRuleSetAndAdd(const CSSSelector& component, RuleData& rule
     AtomicString className;
     AtomicString customPseudoElementName;
     AtomicString tagName;
+    AtomicString attributeName;
 
 #ifndef NDEBUG
     m_allRules.append(ruleData);
@@ -182,11 +191,11 @@ bool RuleSet::findBestRuleSetAndAdd(const CSSSelector& component, RuleData& rule
 
     const CSSSelector* it = &component;
     for (; it && it->relation() == CSSSelector::SubSelector; it = it->tagHistory()) {
-        extractValuesforSelector(it, id, className, customPseudoElementName, tagName);
+        extractValuesforSelector(it, id, className, customPseudoElementName, tagName, attributeName);
     }
     // FIXME: this null check should not be necessary. See crbug.com/358475
     if (it)
-        extractValuesforSelector(it, id, className, customPseudoElementName, tagName);
+        extractValuesforSelector(it, id, className, customPseudoElementName, tagName, attributeName);
 
     // Prefer rule sets in order of most likely to apply infrequently.
     if (!id.isEmpty()) {
@@ -232,6 +241,12 @@ bool RuleSet::findBestRuleSetAndAdd(const CSSSelector& component, RuleData& rule
         return true;
     }
 
+    // Rules like [data-foo] would otherwise be checked against every element.
+    if (!attributeName.isEmpty()) {
+        addToRuleSet(attributeName, ensurePendingRules()->attributeRules, ruleData);
+        return true;
+    }
+
     return false;
 }
 
@@ -355,6 +370,7 @@ void RuleSet::compactRules()
     compactPendingRules(pendingRules->classRules, m_classRules);
     compactPendingRules(pendingRules->tagRules, m_tagRules);
     compactPendingRules(pendingRules->shadowPseudoElementRules, m_shadowPseudoElementRules);
+    compactPendingRules(pendingRules->attributeRules, m_attributeRules);
     m_linkPseudoClassRules.shrinkToFit();
     m_cuePseudoRules.shrinkToFit();
     m_focusPseudoClassRules.shrinkToFit();
@@ -384,6 +400,7 @@ void RuleSet::PendingRuleMaps::trace(Visitor* visitor)
     visitor->trace(classRules);
     visitor->trace(tagRules);
     visitor->trace(shadowPseudoElementRules);
+    visitor->trace(attributeRules);
 #endif
 }
 
@@ -394,6 +411,7 @@ void RuleSet::trace(Visitor* visitor)
     visitor->trace(m_classRules);
     visitor->trace(m_tagRules);
     visitor->trace(m_shadowPseudoElementRules);
+    visitor->trace(m_attributeRules);
     visitor->trace(m_linkPseudoClassRules);
     visitor->trace(m_cuePseudoRules);
     visitor->trace(m_focusPseudoClassRules);
@@ -419,6 +437,30 @@ void RuleSet::show()
     for (WillBeHeapVector<RuleData>::const_iterator it = m_allRules.begin(); it != m_allRules.end(); ++it)
         it->selector().show();
 }
+
+template <typename RuleMap>
+static void showRuleMapStatistics(const char* name, const RuleMap& map)
+{
+    size_t ruleCount = 0;
+    size_t largestBucket = 0;
+    for (typename RuleMap::const_iterator it = map.begin(); it != map.end(); ++it) {
+        ruleCount += it->value->size();
+        largestBucket = std::max(largestBucket, it->value->size());
+    }
+    printf("  %s: %u buckets, %zu rules, largest bucket %zu\n", name, map.size(), ruleCount, largestBucket);
+}
+
+void RuleSet::showStatistics()
+{
+    compactRulesIfNeeded();
+    printf("RuleSet %p: %u rules\n", this, m_ruleCount);
+    showRuleMapStatistics("id", m_idRules);
+    showRuleMapStatistics("class", m_classRules);
+    showRuleMapStatistics("tag", m_tagRules);
+    showRuleMapStatistics("attribute", m_attributeRules);
+    showRuleMapStatistics("shadow pseudo element", m_shadowPseudoElementRules);
+    printf("  link: %zu, focus: %zu, cue: %zu, universal: %zu rules\n", m_linkPseudoClassRules.size(), m_focusPseudoClassRules.size(), m_cuePseudoRules.size(), m_universalRules.size());
+}
 #endif
 
 } // namespace blink
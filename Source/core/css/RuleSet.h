@@ -138,6 +138,8 @@ public:
     const WillBeHeapTerminatedArray<RuleData>* classRules(const AtomicString& key) const { ASSERT(!m_pendingRules); return m_classRules.get(key); }
     const WillBeHeapTerminatedArray<RuleData>* tagRules(const AtomicString& key) const { ASSERT(!m_pendingRules); return m_tagRules.get(key); }
     const WillBeHeapTerminatedArray<RuleData>* shadowPseudoElementRules(const AtomicString& key) const { ASSERT(!m_pendingRules); return m_shadowPseudoElementRules.get(key); }
+    const WillBeHeapTerminatedArray<RuleData>* attributeRules(const AtomicString& key) const { ASSERT(!m_pendingRules); return m_attributeRules.get(key); }
+    bool hasAttributeRules() const { ASSERT(!m_pendingRules); return !m_attributeRules.isEmpty(); }
     const WillBeHeapVector<RuleData>* linkPseudoClassRules() const { ASSERT(!m_pendingRules); return &m_linkPseudoClassRules; }
     const WillBeHeapVector<RuleData>* cuePseudoRules() const { ASSERT(!m_pendingRules); return &m_cuePseudoRules; }
     const WillBeHeapVector<RuleData>* focusPseudoClassRules() const { ASSERT(!m_pendingRules); return &m_focusPseudoClassRules; }
@@ -161,6 +163,7 @@ public:
 
 #ifndef NDEBUG
     void show();
+    void showStatistics();
 #endif
 
     void trace(Visitor*);
@@ -194,6 +197,7 @@ private:
         PendingRuleMap classRules;
         PendingRuleMap tagRules;
         PendingRuleMap shadowPseudoElementRules;
+        PendingRuleMap attributeRules;
 
         void trace(Visitor*);
 
@@ -212,6 +216,7 @@ private:
     CompactRuleMap m_classRules;
     CompactRuleMap m_tagRules;
     CompactRuleMap m_shadowPseudoElementRules;
+    CompactRuleMap m_attributeRules;
     WillBeHeapVector<RuleData> m_linkPseudoClassRules;
     WillBeHeapVector<RuleData> m_cuePseudoRules;
     WillBeHeapVector<RuleData> m_focusPseudoClassRules;
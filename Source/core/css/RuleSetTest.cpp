@@ -123,6 +123,42 @@ TEST(RuleSetTest, findBestRuleSetAndAdd_TagThenAttrThenId)
     ASSERT_EQ(tagStr, rules->at(0).selector().tagQName().localName());
 }
 
+TEST(RuleSetTest, findBestRuleSetAndAdd_Attr)
+{
+    CSSTestHelper helper;
+
+    helper.addCSSRules("[data-attr] { }");
+    RuleSet& ruleSet = helper.ruleSet();
+    AtomicString str("data-attr");
+    const TerminatedArray<RuleData>* rules = ruleSet.attributeRules(str);
+    ASSERT_EQ(1u, rules->size());
+    ASSERT_EQ(str, rules->at(0).selector().attribute().localName());
+    ASSERT_TRUE(ruleSet.universalRules()->isEmpty());
+}
+
+TEST(RuleSetTest, findBestRuleSetAndAdd_TagThenAttr)
+{
+    CSSTestHelper helper;
+
+    helper.addCSSRules("div[attr] { }");
+    RuleSet& ruleSet = helper.ruleSet();
+    // Tag rules are preferred over attribute rules.
+    const TerminatedArray<RuleData>* rules = ruleSet.tagRules(AtomicString("div"));
+    ASSERT_EQ(1u, rules->size());
+    ASSERT_FALSE(ruleSet.attributeRules(AtomicString("attr")));
+}
+
+TEST(RuleSetTest, findBestRuleSetAndAdd_StyleAttr)
+{
+    CSSTestHelper helper;
+
+    helper.addCSSRules("[style] { }");
+    RuleSet& ruleSet = helper.ruleSet();
+    // The style attribute is synchronized lazily, so it cannot be bucketed.
+    ASSERT_FALSE(ruleSet.hasAttributeRules());
+    ASSERT_EQ(1u, ruleSet.universalRules()->size());
+}
+
 TEST(RuleSetTest, findBestRuleSetAndAdd_DivWithContent)
 {
     CSSTestHelper helper;
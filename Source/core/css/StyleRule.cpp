@@ -30,9 +30,15 @@
 #include "core/css/CSSPageRule.h"
 #include "core/css/CSSStyleRule.h"
 #include "core/css/CSSSupportsRule.h"
+#include "core/css/CSSValuePool.h"
 #include "core/css/CSSViewportRule.h"
 #include "core/css/StylePropertySet.h"
 #include "core/css/StyleRuleImport.h"
+#include "core/css/StyleSheetContents.h"
+#include "core/css/parser/CSSParser.h"
+#include "core/frame/UseCounter.h"
+#include "wtf/HashMap.h"
+#include "wtf/MainThread.h"
 
 namespace blink {
 
@@ -250,6 +256,41 @@ unsigned StyleRule::averageSizeInBytes()
     return sizeof(StyleRule) + sizeof(CSSSelector) + StylePropertySet::averageSizeInBytes();
 }
 
+LazyStyleRuleContext::LazyStyleRuleContext(const CSSParserContext& context, StyleSheetContents* styleSheet)
+    : m_parserContext(context, 0)
+    , m_styleSheet(styleSheet)
+    , m_sharedValueCount(0)
+{
+}
+
+LazyStyleRuleContext::~LazyStyleRuleContext()
+{
+    CSSValuePool::recordSharedValueCountForSheet(m_sharedValueCount);
+}
+
+CSSParserContext LazyStyleRuleContext::parserContext() const
+{
+    return CSSParserContext(m_parserContext, UseCounter::getFrom(m_styleSheet));
+}
+
+namespace {
+
+struct LazyDeclarationBlock {
+    String text;
+    RefPtr<LazyStyleRuleContext> context;
+};
+
+} // namespace
+
+typedef HashMap<const StyleRule*, LazyDeclarationBlock> LazyDeclarationBlockMap;
+
+static LazyDeclarationBlockMap& lazyDeclarationBlocks()
+{
+    ASSERT(isMainThread());
+    DEFINE_STATIC_LOCAL(LazyDeclarationBlockMap, map, ());
+    return map;
+}
+
 StyleRule::StyleRule()
     : StyleRuleBase(Style)
 {
@@ -257,27 +298,49 @@ StyleRule::StyleRule()
 
 StyleRule::StyleRule(const StyleRule& o)
     : StyleRuleBase(o)
-    , m_properties(o.m_properties->mutableCopy())
+    , m_properties(o.properties().mutableCopy())
     , m_selectorList(o.m_selectorList)
 {
 }
 
 StyleRule::~StyleRule()
 {
+    if (!m_properties)
+        lazyDeclarationBlocks().remove(this);
 }
 
 MutableStylePropertySet& StyleRule::mutableProperties()
 {
-    if (!m_properties->isMutable())
+    if (!properties().isMutable())
         m_properties = m_properties->mutableCopy();
     return *toMutableStylePropertySet(m_properties.get());
 }
 
 void StyleRule::setProperties(PassRefPtrWillBeRawPtr<StylePropertySet> properties)
 {
+    if (!m_properties)
+        lazyDeclarationBlocks().remove(this);
     m_properties = properties;
 }
 
+void StyleRule::setLazyProperties(const String& declarationBlock, PassRefPtr<LazyStyleRuleContext> context)
+{
+    m_properties = nullptr;
+    LazyDeclarationBlock& block = lazyDeclarationBlocks().add(this, LazyDeclarationBlock()).storedValue->value;
+    block.text = declarationBlock;
+    block.context = context;
+}
+
+void StyleRule::parseLazyProperties() const
+{
+    ASSERT(!m_properties);
+    LazyDeclarationBlock block = lazyDeclarationBlocks().take(this);
+    ASSERT(block.context);
+    unsigned sharedValueCount = cssValuePool().sharedValueCount();
+    m_properties = CSSParser::parseDeclarationBlock(block.context->parserContext(), block.text);
+    block.context->didShareValues(cssValuePool().sharedValueCount() - sharedValueCount);
+}
+
 void StyleRule::traceAfterDispatch(Visitor* visitor)
 {
     visitor->trace(m_properties);
@@ -24,7 +24,9 @@
 
 #include "core/css/CSSSelectorList.h"
 #include "core/css/MediaList.h"
+#include "core/css/parser/CSSParserMode.h"
 #include "platform/heap/Handle.h"
+#include "wtf/RefCounted.h"
 #include "wtf/RefPtr.h"
 
 namespace blink {
@@ -33,6 +35,7 @@ class CSSRule;
 class CSSStyleSheet;
 class MutableStylePropertySet;
 class StylePropertySet;
+class StyleSheetContents;
 
 class StyleRuleBase : public RefCountedWillBeGarbageCollectedFinalized<StyleRuleBase> {
     WTF_MAKE_FAST_ALLOCATED_WILL_BE_REMOVED;
@@ -97,6 +100,29 @@ private:
     unsigned m_type : 5;
 };
 
+// The parser context shared by the style rules of a sheet whose declaration
+// blocks are parsed on first use. The UseCounter is looked up through the sheet
+// when a block is parsed, since the sheet may move to another document first.
+// The sheet detaches itself when its rules are cleared or it goes away.
+// CSSValuePool hits of the whole sheet, eager and lazy, are recorded once the
+// last rule releases the context.
+class LazyStyleRuleContext : public RefCounted<LazyStyleRuleContext> {
+public:
+    static PassRefPtr<LazyStyleRuleContext> create(const CSSParserContext& context, StyleSheetContents* styleSheet) { return adoptRef(new LazyStyleRuleContext(context, styleSheet)); }
+    ~LazyStyleRuleContext();
+
+    CSSParserContext parserContext() const;
+    void clearStyleSheet() { m_styleSheet = 0; }
+    void didShareValues(unsigned count) { m_sharedValueCount += count; }
+
+private:
+    LazyStyleRuleContext(const CSSParserContext&, StyleSheetContents*);
+
+    CSSParserContext m_parserContext;
+    StyleSheetContents* m_styleSheet;
+    unsigned m_sharedValueCount;
+};
+
 class StyleRule : public StyleRuleBase {
     WTF_MAKE_FAST_ALLOCATED_WILL_BE_REMOVED;
 public:
@@ -105,12 +131,20 @@ public:
     ~StyleRule();
 
     const CSSSelectorList& selectorList() const { return m_selectorList; }
-    const StylePropertySet& properties() const { return *m_properties; }
+    const StylePropertySet& properties() const
+    {
+        if (UNLIKELY(!m_properties))
+            parseLazyProperties();
+        return *m_properties;
+    }
     MutableStylePropertySet& mutableProperties();
+    bool hasParsedProperties() const { return !!m_properties; }
 
     void parserAdoptSelectorVector(Vector<OwnPtr<CSSParserSelector> >& selectors) { m_selectorList.adoptSelectorVector(selectors); }
     void wrapperAdoptSelectorList(CSSSelectorList& selectors) { m_selectorList.adopt(selectors); }
     void setProperties(PassRefPtrWillBeRawPtr<StylePropertySet>);
+    // Defers parsing of the declaration block until properties() is first called.
+    void setLazyProperties(const String& declarationBlock, PassRefPtr<LazyStyleRuleContext>);
 
     PassRefPtrWillBeRawPtr<StyleRule> copy() const { return adoptRefWillBeNoop(new StyleRule(*this)); }
 
@@ -122,7 +156,11 @@ private:
     StyleRule();
     StyleRule(const StyleRule&);
 
-    RefPtrWillBeMember<StylePropertySet> m_properties; // Cannot be null.
+    void parseLazyProperties() const;
+
+    // Null until the lazy declaration block is parsed. Lazy declaration blocks
+    // are kept in a side table, so that parsed rules don't pay for them.
+    mutable RefPtrWillBeMember<StylePropertySet> m_properties;
     CSSSelectorList m_selectorList;
 };
 
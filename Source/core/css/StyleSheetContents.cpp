@@ -101,6 +101,8 @@ StyleSheetContents::~StyleSheetContents()
 {
 #if !ENABLE(OILPAN)
     clearRules();
+#else
+    detachLazyStyleRuleContexts();
 #endif
 }
 
@@ -214,6 +216,19 @@ void StyleSheetContents::clearRules()
     m_importRules.clear();
     m_childRules.clear();
     clearCharsetRule();
+    detachLazyStyleRuleContexts();
+}
+
+void StyleSheetContents::parserAddLazyStyleRuleContext(PassRefPtr<LazyStyleRuleContext> context)
+{
+    m_lazyStyleRuleContexts.append(context);
+}
+
+void StyleSheetContents::detachLazyStyleRuleContexts()
+{
+    for (size_t i = 0; i < m_lazyStyleRuleContexts.size(); ++i)
+        m_lazyStyleRuleContexts[i]->clearStyleSheet();
+    m_lazyStyleRuleContexts.clear();
 }
 
 void StyleSheetContents::parserSetEncodingFromCharsetRule(const String& encoding)
@@ -483,7 +498,8 @@ static bool childRulesHaveFailedOrCanceledSubresources(const WillBeHeapVector<Re
         const StyleRuleBase* rule = rules[i].get();
         switch (rule->type()) {
         case StyleRuleBase::Style:
-            if (toStyleRule(rule)->properties().hasFailedOrCanceledSubresources())
+            // A declaration block that has not been parsed yet has not started any loads.
+            if (toStyleRule(rule)->hasParsedProperties() && toStyleRule(rule)->properties().hasFailedOrCanceledSubresources())
                 return true;
             break;
         case StyleRuleBase::FontFace:
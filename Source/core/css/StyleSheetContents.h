@@ -37,6 +37,7 @@ namespace blink {
 
 class CSSStyleSheet;
 class CSSStyleSheetResource;
+class LazyStyleRuleContext;
 class Document;
 class Node;
 class SecurityOrigin;
@@ -99,6 +100,8 @@ public:
     void parserAppendRule(PassRefPtrWillBeRawPtr<StyleRuleBase>);
     void parserSetEncodingFromCharsetRule(const String& encoding);
     void parserSetUsesRemUnits(bool b) { m_usesRemUnits = b; }
+    // Lets rules whose declaration blocks are parsed lazily find this sheet until it goes away.
+    void parserAddLazyStyleRuleContext(PassRefPtr<LazyStyleRuleContext>);
 
     void clearRules();
 
@@ -170,6 +173,7 @@ private:
 
     Document* clientSingleOwnerDocument() const;
     void clearCharsetRule();
+    void detachLazyStyleRuleContexts();
 
     RawPtrWillBeMember<StyleRuleImport> m_ownerRule;
 
@@ -197,6 +201,7 @@ private:
     typedef WillBeHeapHashSet<RawPtrWillBeWeakMember<CSSStyleSheet> >::iterator ClientsIterator;
 
     OwnPtrWillBeMember<RuleSet> m_ruleSet;
+    Vector<RefPtr<LazyStyleRuleContext> > m_lazyStyleRuleContexts;
 };
 
 } // namespace
@@ -37,7 +37,8 @@
 namespace blink {
 
 DescendantInvalidationSet::DescendantInvalidationSet()
-    : m_allDescendantsMightBeInvalid(false)
+    : m_maxSiblingDistance(0)
+    , m_allDescendantsMightBeInvalid(false)
     , m_customPseudoInvalid(false)
     , m_treeBoundaryCrossing(false)
 {
@@ -74,6 +75,12 @@ bool DescendantInvalidationSet::invalidatesElement(Element& element) const
 
 void DescendantInvalidationSet::combine(const DescendantInvalidationSet& other)
 {
+    // Sibling invalidation is independent of how much of the subtree is invalid.
+    if (other.m_siblingInvalidationSet) {
+        ensureSiblingInvalidationSet().combine(*other.m_siblingInvalidationSet);
+        updateMaxSiblingDistance(other.m_maxSiblingDistance);
+    }
+
     // No longer bother combining data structures, since the whole subtree is deemed invalid.
     if (wholeSubtreeInvalid())
         return;
@@ -142,6 +149,13 @@ WillBeHeapHashSet<AtomicString>& DescendantInvalidationSet::ensureAttributeSet()
     return *m_attributes;
 }
 
+DescendantInvalidationSet& DescendantInvalidationSet::ensureSiblingInvalidationSet()
+{
+    if (!m_siblingInvalidationSet)
+        m_siblingInvalidationSet = DescendantInvalidationSet::create();
+    return *m_siblingInvalidationSet;
+}
+
 void DescendantInvalidationSet::addClass(const AtomicString& className)
 {
     if (wholeSubtreeInvalid())
@@ -190,6 +204,7 @@ void DescendantInvalidationSet::trace(Visitor* visitor)
     visitor->trace(m_ids);
     visitor->trace(m_tagNames);
     visitor->trace(m_attributes);
+    visitor->trace(m_siblingInvalidationSet);
 #endif
 }
 
@@ -220,6 +235,10 @@ void DescendantInvalidationSet::show() const
             fprintf(stderr, "[%s] ", (*it).ascii().data());
     }
     fprintf(stderr, "}\n");
+    if (m_siblingInvalidationSet) {
+        fprintf(stderr, "  siblings (distance %u): ", m_maxSiblingDistance);
+        m_siblingInvalidationSet->show();
+    }
 }
 #endif // NDEBUG
 
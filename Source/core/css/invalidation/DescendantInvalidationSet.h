@@ -72,6 +72,18 @@ public:
 
     bool isEmpty() const { return !m_classes && !m_ids && !m_tagNames && !m_attributes; }
 
+    // Features of following siblings which might be invalid when the feature
+    // this set belongs to changes, as in ".a + .b" or ".a ~ .b". Siblings up to
+    // maxSiblingDistance() elements away are checked against the sibling set.
+    DescendantInvalidationSet& ensureSiblingInvalidationSet();
+    const DescendantInvalidationSet* siblingInvalidationSet() const { return m_siblingInvalidationSet.get(); }
+    void updateMaxSiblingDistance(unsigned distance)
+    {
+        if (distance > m_maxSiblingDistance)
+            m_maxSiblingDistance = distance;
+    }
+    unsigned maxSiblingDistance() const { return m_maxSiblingDistance; }
+
     void trace(Visitor*);
 
 #ifndef NDEBUG
@@ -92,6 +104,9 @@ private:
     OwnPtrWillBeMember<WillBeHeapHashSet<AtomicString> > m_tagNames;
     OwnPtrWillBeMember<WillBeHeapHashSet<AtomicString> > m_attributes;
 
+    RefPtrWillBeMember<DescendantInvalidationSet> m_siblingInvalidationSet;
+    unsigned m_maxSiblingDistance;
+
     // If true, all descendants might be invalidated, so a full subtree recalc is required.
     unsigned m_allDescendantsMightBeInvalid : 1;
 
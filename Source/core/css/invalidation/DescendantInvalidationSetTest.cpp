@@ -61,4 +61,24 @@ TEST(DescendantInvalidationSetTest, SubtreeInvalid_Combine_2)
     ASSERT_TRUE(set1->isEmpty());
 }
 
+// Sibling sets survive combining with a wholeSubtreeInvalid set, and the larger distance wins.
+TEST(DescendantInvalidationSetTest, SiblingSet_Combine)
+{
+    RefPtrWillBeRawPtr<DescendantInvalidationSet> set1 = DescendantInvalidationSet::create();
+    RefPtrWillBeRawPtr<DescendantInvalidationSet> set2 = DescendantInvalidationSet::create();
+
+    set1->setWholeSubtreeInvalid();
+    set1->ensureSiblingInvalidationSet().addClass("a");
+    set1->updateMaxSiblingDistance(1);
+    set2->ensureSiblingInvalidationSet().addClass("b");
+    set2->updateMaxSiblingDistance(2);
+
+    set1->combine(*set2);
+
+    ASSERT_TRUE(set1->wholeSubtreeInvalid());
+    ASSERT_TRUE(set1->siblingInvalidationSet());
+    ASSERT_FALSE(set1->siblingInvalidationSet()->isEmpty());
+    ASSERT_EQ(2u, set1->maxSiblingDistance());
+}
+
 } // namespace
@@ -31,6 +31,8 @@ void StyleInvalidator::scheduleInvalidation(PassRefPtrWillBeRawPtr<DescendantInv
 {
     ASSERT(element.inActiveDocument());
     ASSERT(element.styleChangeType() < SubtreeStyleChange);
+    if (const DescendantInvalidationSet* siblingSet = invalidationSet->siblingInvalidationSet())
+        scheduleSiblingInvalidation(*siblingSet, invalidationSet->maxSiblingDistance(), element);
     InvalidationList& list = ensurePendingInvalidationList(element);
     // If we're already going to invalidate the whole subtree we don't need to store any new sets.
     if (!list.isEmpty() && list.last()->wholeSubtreeInvalid())
@@ -42,6 +44,21 @@ void StyleInvalidator::scheduleInvalidation(PassRefPtrWillBeRawPtr<DescendantInv
     element.setNeedsStyleInvalidation();
 }
 
+// Siblings affected by a change to the given element are marked directly rather
+// than through a pending invalidation list, since the invalidation traversal
+// only walks descendants. Only the siblings matching the features of the sibling
+// set need a recalc, instead of the whole sibling subtrees that would otherwise be
+// forced by ContainerNode::checkForChildrenAdjacentRuleChanges.
+void StyleInvalidator::scheduleSiblingInvalidation(const DescendantInvalidationSet& siblingSet, unsigned maxDistance, Element& element)
+{
+    unsigned distance = 0;
+    for (Element* sibling = ElementTraversal::nextSibling(element); sibling && distance < maxDistance; sibling = ElementTraversal::nextSibling(*sibling)) {
+        ++distance;
+        if (sibling->styleChangeType() < LocalStyleChange && siblingSet.invalidatesElement(*sibling))
+            sibling->setNeedsStyleRecalc(LocalStyleChange);
+    }
+}
+
 StyleInvalidator::InvalidationList& StyleInvalidator::ensurePendingInvalidationList(Element& element)
 {
     PendingInvalidationMap::AddResult addResult = m_pendingInvalidationMap.add(&element, nullptr);
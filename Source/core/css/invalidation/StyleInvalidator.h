@@ -52,6 +52,8 @@ private:
         bool m_treeBoundaryCrossing;
     };
 
+    void scheduleSiblingInvalidation(const DescendantInvalidationSet& siblingSet, unsigned maxDistance, Element&);
+
     bool invalidate(Element&, RecursionData&);
     bool invalidateChildren(Element&, RecursionData&);
     bool checkInvalidationSetsAgainstElement(Element&, RecursionData&);
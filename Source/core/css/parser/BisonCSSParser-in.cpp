@@ -156,9 +156,20 @@ void BisonCSSParser::parseSheet(StyleSheetContents* sheet, const String& string,
     m_startPosition = startPosition;
     m_source = &string;
     m_tokenizer.m_internal = false;
+    if (!m_observer && !m_logErrors) {
+        m_lazyStyleRuleContext = LazyStyleRuleContext::create(m_context, sheet);
+        sheet->parserAddLazyStyleRuleContext(m_lazyStyleRuleContext);
+    }
+    unsigned sharedValueCount = cssValuePool().sharedValueCount();
     setupParser("", string, "");
     cssyyparse(this);
     sheet->shrinkToFit();
+    sharedValueCount = cssValuePool().sharedValueCount() - sharedValueCount;
+    if (m_lazyStyleRuleContext)
+        m_lazyStyleRuleContext->didShareValues(sharedValueCount);
+    else
+        CSSValuePool::recordSharedValueCountForSheet(sharedValueCount);
+    m_lazyStyleRuleContext = nullptr;
     m_source = 0;
     m_rule = nullptr;
     m_lineEndings.clear();
@@ -1022,6 +1033,11 @@ PassRefPtrWillBeRawPtr<ImmutableStylePropertySet> BisonCSSParser::parseInlineSty
     return BisonCSSParser(context).parseDeclaration(string, document.elementSheet().contents());
 }
 
+PassRefPtrWillBeRawPtr<ImmutableStylePropertySet> BisonCSSParser::parseDeclarationBlock(const CSSParserContext& context, const String& declarationBlock)
+{
+    return BisonCSSParser(context).parseDeclaration(declarationBlock, 0);
+}
+
 PassRefPtrWillBeRawPtr<ImmutableStylePropertySet> BisonCSSParser::parseDeclaration(const String& string, StyleSheetContents* contextStyleSheet)
 {
     setStyleSheet(contextStyleSheet);
@@ -1762,6 +1778,23 @@ StyleRuleBase* BisonCSSParser::createStyleRule(Vector<OwnPtr<CSSParserSelector>
     return result;
 }
 
+StyleRuleBase* BisonCSSParser::createLazyStyleRule(Vector<OwnPtr<CSSParserSelector> >* selectors, const CSSParserString& declarationBlock)
+{
+    ASSERT(m_lazyStyleRuleContext);
+    StyleRule* result = 0;
+    if (selectors) {
+        m_allowImportRules = m_allowNamespaceDeclarations = false;
+        RefPtrWillBeRawPtr<StyleRule> rule = StyleRule::create();
+        rule->parserAdoptSelectorVector(*selectors);
+        rule->setLazyProperties(declarationBlock, m_lazyStyleRuleContext);
+        result = rule.get();
+        m_parsedRules.append(rule.release());
+        recordSelectorStats(m_context, result->selectorList());
+    }
+    clearProperties();
+    return result;
+}
+
 StyleRuleBase* BisonCSSParser::createFontFaceRule()
 {
     m_allowImportRules = m_allowNamespaceDeclarations = false;
@@ -2024,6 +2057,14 @@ void BisonCSSParser::endSelector()
         m_observer->endSelector(m_tokenizer.safeUserStringTokenOffset());
 }
 
+void BisonCSSParser::startLazyDeclarationBlock()
+{
+    // Runs with the style rule's '{' as the lookahead token, so the next token
+    // requested from the tokenizer begins the declaration block.
+    if (m_lazyStyleRuleContext && m_tokenizer.m_token == '{')
+        m_tokenizer.m_lexLazyDeclarationBlock = true;
+}
+
 void BisonCSSParser::startRuleBody()
 {
     if (m_observer)
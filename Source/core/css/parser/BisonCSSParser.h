@@ -53,6 +53,7 @@ class CSSValueList;
 class Document;
 class Element;
 class ImmutableStylePropertySet;
+class LazyStyleRuleContext;
 class MediaQueryExp;
 class MediaQuerySet;
 class MutableStylePropertySet;
@@ -91,6 +92,7 @@ public:
     static bool parseSystemColor(RGBA32& color, const String&);
     bool parseDeclaration(MutableStylePropertySet*, const String&, CSSParserObserver*, StyleSheetContents* contextStyleSheet);
     static PassRefPtrWillBeRawPtr<ImmutableStylePropertySet> parseInlineStyleDeclaration(const String&, Element*);
+    static PassRefPtrWillBeRawPtr<ImmutableStylePropertySet> parseDeclarationBlock(const CSSParserContext&, const String&);
     PassOwnPtr<Vector<double> > parseKeyframeKeyList(const String&);
     bool parseAttributeMatchType(CSSSelector::AttributeMatchType&, const String&);
 
@@ -123,6 +125,7 @@ public:
     RuleList* createRuleList();
     RuleList* appendRule(RuleList*, StyleRuleBase*);
     StyleRuleBase* createStyleRule(Vector<OwnPtr<CSSParserSelector> >* selectors);
+    StyleRuleBase* createLazyStyleRule(Vector<OwnPtr<CSSParserSelector> >* selectors, const CSSParserString& declarationBlock);
     StyleRuleBase* createFontFaceRule();
     StyleRuleBase* createPageRule(PassOwnPtr<CSSParserSelector> pageSelector);
     StyleRuleBase* createMarginAtRule(CSSSelector::MarginBoxType);
@@ -196,6 +199,7 @@ public:
     void endRuleHeader();
     void startSelector();
     void endSelector();
+    void startLazyDeclarationBlock();
     void startRuleBody();
     void startProperty();
     void endProperty(bool isImportantFound, bool isPropertyParsed, CSSParserError = NoCSSError);
@@ -274,6 +278,10 @@ private:
 
     bool m_inViewport;
 
+    // Non-null while parsing a sheet whose style rule declaration blocks may be
+    // parsed on first use rather than up front.
+    RefPtr<LazyStyleRuleContext> m_lazyStyleRuleContext;
+
     CSSParserLocation m_locationLabel;
 
     WillBeHeapVector<RefPtrWillBeMember<StyleRuleBase> > m_parsedRules;
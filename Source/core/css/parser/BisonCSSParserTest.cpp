@@ -5,8 +5,17 @@
 #include "config.h"
 #include "core/css/parser/BisonCSSParser.h"
 
+#include "core/css/CSSStyleSheet.h"
 #include "core/css/MediaList.h"
+#include "core/css/StylePropertySet.h"
 #include "core/css/StyleRule.h"
+#include "core/css/StyleSheetContents.h"
+#include "core/dom/Document.h"
+#include "core/frame/UseCounter.h"
+#include "core/html/HTMLElement.h"
+#include "core/html/HTMLStyleElement.h"
+#include "core/testing/DummyPageHolder.h"
+#include "platform/RuntimeEnabledFeatures.h"
 #include "wtf/dtoa/utils.h"
 #include "wtf/text/StringBuilder.h"
 
@@ -55,4 +64,69 @@ TEST(BisonCSSParserTest, MediaQuery)
     }
 }
 
+TEST(BisonCSSParserTest, LazyDeclarationBlocks)
+{
+    RefPtrWillBeRawPtr<StyleSheetContents> sheet = StyleSheetContents::create(strictCSSParserContext());
+    BisonCSSParser parser(strictCSSParserContext());
+    parser.parseSheet(sheet.get(), "a { color: red; content: \"}\" } b { /* } */ width: calc(1rem + 2px) }");
+
+    const WillBeHeapVector<RefPtrWillBeMember<StyleRuleBase> >& rules = sheet->childRules();
+    ASSERT_EQ(2u, rules.size());
+    EXPECT_TRUE(sheet->usesRemUnits());
+
+    StyleRule* first = toStyleRule(rules[0].get());
+    EXPECT_FALSE(first->hasParsedProperties());
+    EXPECT_EQ(2u, first->properties().propertyCount());
+    EXPECT_TRUE(first->hasParsedProperties());
+
+    StyleRule* second = toStyleRule(rules[1].get());
+    EXPECT_FALSE(second->hasParsedProperties());
+    EXPECT_TRUE(second->properties().hasProperty(CSSPropertyWidth));
+}
+
+TEST(BisonCSSParserTest, LazyDeclarationBlocksAreUseCounted)
+{
+    OwnPtr<DummyPageHolder> dummyPageHolder = DummyPageHolder::create(IntSize(800, 600));
+    Document& document = dummyPageHolder->document();
+    document.body()->setInnerHTML("<style id='style'>a { cursor: -webkit-zoom-in }</style>", ASSERT_NO_EXCEPTION);
+
+    CSSStyleSheet* sheet = toHTMLStyleElement(document.getElementById("style"))->sheet();
+    ASSERT_TRUE(sheet);
+    const WillBeHeapVector<RefPtrWillBeMember<StyleRuleBase> >& rules = sheet->contents()->childRules();
+    ASSERT_EQ(1u, rules.size());
+    StyleRule* rule = toStyleRule(rules[0].get());
+    ASSERT_FALSE(rule->hasParsedProperties());
+    EXPECT_FALSE(UseCounter::isCounted(document, UseCounter::PrefixedCursorZoomIn));
+
+    // Parsing the declarations counts the prefixed value.
+    EXPECT_TRUE(rule->properties().hasProperty(CSSPropertyCursor));
+    EXPECT_TRUE(rule->hasParsedProperties());
+    EXPECT_TRUE(UseCounter::isCounted(document, UseCounter::PrefixedCursorZoomIn));
+}
+
+TEST(BisonCSSParserTest, ContentSkipping)
+{
+    bool contentSkippingEnabled = RuntimeEnabledFeatures::cssContentSkippingEnabled();
+    RuntimeEnabledFeatures::setCSSContentSkippingEnabled(true);
+
+    struct {
+        const char* input;
+        bool valid;
+    } testCases[] = {
+        {"none", true},
+        {"100px", true},
+        {"0", true},
+        {"-1px", false},
+        {"auto", false},
+        {"50%", false},
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(testCases); ++i) {
+        RefPtrWillBeRawPtr<MutableStylePropertySet> properties = MutableStylePropertySet::create();
+        EXPECT_EQ(testCases[i].valid, BisonCSSParser::parseValue(properties.get(), CSSPropertyContentSkipping, testCases[i].input, false, HTMLStandardMode, 0)) << testCases[i].input;
+    }
+
+    RuntimeEnabledFeatures::setCSSContentSkippingEnabled(contentSkippingEnabled);
+}
+
 } // namespace blink
@@ -169,6 +169,7 @@ inline static CSSParserValue makeIdentValue(CSSParserString string)
 %token <string> STRING
 %right <string> IDENT
 %token <string> NTH
+%token <string> LAZY_DECLARATION_BLOCK
 
 %nonassoc <string> HEX
 %nonassoc <string> IDSEL
@@ -1090,10 +1091,20 @@ at_selector_end:
     }
   ;
 
+at_style_rule_header_end:
+    /* empty */ {
+        parser->endRuleHeader();
+        parser->startLazyDeclarationBlock();
+    }
+  ;
+
 ruleset:
-    before_selector_list selector_list at_selector_end at_rule_header_end '{' at_rule_body_start maybe_space_before_declaration declaration_list closing_brace {
+    before_selector_list selector_list at_selector_end at_style_rule_header_end '{' at_rule_body_start maybe_space_before_declaration declaration_list closing_brace {
         $$ = parser->createStyleRule($2);
     }
+  | before_selector_list selector_list at_selector_end at_style_rule_header_end '{' at_rule_body_start LAZY_DECLARATION_BLOCK closing_brace {
+        $$ = parser->createLazyStyleRule($2, $7);
+    }
   ;
 
 before_selector_group_item:
@@ -61,6 +61,11 @@ PassRefPtrWillBeRawPtr<ImmutableStylePropertySet> CSSParser::parseInlineStyleDec
     return BisonCSSParser::parseInlineStyleDeclaration(styleString, element);
 }
 
+PassRefPtrWillBeRawPtr<ImmutableStylePropertySet> CSSParser::parseDeclarationBlock(const CSSParserContext& context, const String& declarationBlock)
+{
+    return BisonCSSParser::parseDeclarationBlock(context, declarationBlock);
+}
+
 PassOwnPtr<Vector<double> > CSSParser::parseKeyframeKeyList(const String& keyList)
 {
     return BisonCSSParser(strictCSSParserContext()).parseKeyframeKeyList(keyList);
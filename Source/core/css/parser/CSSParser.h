@@ -28,6 +28,7 @@ public:
     static PassRefPtrWillBeRawPtr<CSSValue> parseSingleValue(CSSPropertyID, const String&, const CSSParserContext& = strictCSSParserContext());
 
     static PassRefPtrWillBeRawPtr<ImmutableStylePropertySet> parseInlineStyleDeclaration(const String&, Element*);
+    static PassRefPtrWillBeRawPtr<ImmutableStylePropertySet> parseDeclarationBlock(const CSSParserContext&, const String&);
 
     static PassOwnPtr<Vector<double> > parseKeyframeKeyList(const String&);
     static PassRefPtrWillBeRawPtr<StyleKeyframe> parseKeyframeRule(const CSSParserContext&, StyleSheetContents*, const String&);
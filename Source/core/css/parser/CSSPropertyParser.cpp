@@ -334,7 +334,7 @@ PassRefPtrWillBeRawPtr<CSSPrimitiveValue> CSSPropertyParser::createPrimitiveNume
 inline PassRefPtrWillBeRawPtr<CSSPrimitiveValue> CSSPropertyParser::createPrimitiveStringValue(CSSParserValue* value)
 {
     ASSERT(value->unit == CSSPrimitiveValue::CSS_STRING || value->unit == CSSPrimitiveValue::CSS_IDENT);
-    return cssValuePool().createValue(value->string, CSSPrimitiveValue::CSS_STRING);
+    return cssValuePool().createParsedStringValue(value->string, CSSPrimitiveValue::CSS_STRING);
 }
 
 inline PassRefPtrWillBeRawPtr<CSSValue> CSSPropertyParser::createCSSImageValueWithReferrer(const String& rawValue, const KURL& url)
@@ -1474,7 +1474,7 @@ bool CSSPropertyParser::parseValue(CSSPropertyID propId, bool important)
         } else if (value->unit == CSSParserValue::Function) {
             parsedValue = parseBasicShape();
         } else if (value->unit == CSSPrimitiveValue::CSS_URI) {
-            parsedValue = CSSPrimitiveValue::create(value->string, CSSPrimitiveValue::CSS_URI);
+            parsedValue = cssValuePool().createParsedStringValue(value->string, CSSPrimitiveValue::CSS_URI);
             addProperty(propId, parsedValue.release(), important);
             return true;
         }
@@ -1488,6 +1488,10 @@ bool CSSPropertyParser::parseValue(CSSPropertyID propId, bool important)
     case CSSPropertyShapeImageThreshold:
         validPrimitive = (!id && validUnit(value, FNumber));
         break;
+    case CSSPropertyContentSkipping: // none | <length>
+        ASSERT(RuntimeEnabledFeatures::cssContentSkippingEnabled());
+        validPrimitive = (id == CSSValueNone || (!id && validUnit(value, FLength | FNonNeg)));
+        break;
 
     case CSSPropertyTouchAction:
         parsedValue = parseTouchAction();
@@ -7894,7 +7898,7 @@ bool CSSPropertyParser::parseSVGValue(CSSPropertyID propId, bool important)
         if (id == CSSValueNone) {
             validPrimitive = true;
         } else if (value->unit == CSSPrimitiveValue::CSS_URI) {
-            parsedValue = CSSPrimitiveValue::create(value->string, CSSPrimitiveValue::CSS_URI);
+            parsedValue = cssValuePool().createParsedStringValue(value->string, CSSPrimitiveValue::CSS_URI);
             if (parsedValue)
                 m_valueList->next();
         }
@@ -7986,7 +7990,7 @@ bool CSSPropertyParser::parseSVGValue(CSSPropertyID propId, bool important)
                 RGBA32 c = Color::transparent;
                 if (m_valueList->next()) {
                     RefPtrWillBeRawPtr<CSSValueList> values = CSSValueList::createSpaceSeparated();
-                    values->append(CSSPrimitiveValue::create(value->string, CSSPrimitiveValue::CSS_URI));
+                    values->append(cssValuePool().createParsedStringValue(value->string, CSSPrimitiveValue::CSS_URI));
                     if (parseColorFromValue(m_valueList->current(), c))
                         parsedValue = cssValuePool().createColorValue(c);
                     else if (m_valueList->current()->id == CSSValueNone || m_valueList->current()->id == CSSValueCurrentcolor)
@@ -7997,7 +8001,7 @@ bool CSSPropertyParser::parseSVGValue(CSSPropertyID propId, bool important)
                     }
                 }
                 if (!parsedValue)
-                    parsedValue = CSSPrimitiveValue::create(value->string, CSSPrimitiveValue::CSS_URI);
+                    parsedValue = cssValuePool().createParsedStringValue(value->string, CSSPrimitiveValue::CSS_URI);
             } else {
                 parsedValue = parseColor();
             }
@@ -1113,6 +1113,100 @@ inline void CSSTokenizer::detectSupportsToken(int length)
     }
 }
 
+template <typename CharacterType>
+inline bool CSSTokenizer::lexLazyDeclarationBlock(CSSParserString& resultString)
+{
+    // Scans ahead for the '}' which closes the declaration block starting at the
+    // current character. Only the token boundaries that can hide a '}' are tracked,
+    // so blocks containing anything unusual (nested blocks, at-keywords, SGML
+    // comments, unbalanced brackets, unterminated strings or comments) are left
+    // to the regular token stream.
+    CharacterType* current = currentCharacter<CharacterType>();
+    int lineNumber = m_lineNumber;
+    unsigned bracketDepth = 0;
+    bool usesRemUnits = false;
+
+    while (true) {
+        switch (*current) {
+        case '\0':
+        case '{':
+        case '@':
+        case '<':
+            return false;
+        case '}':
+            if (bracketDepth)
+                return false;
+            setTokenStart(currentCharacter<CharacterType>());
+            m_tokenStartLineNumber = m_lineNumber;
+            resultString.init(currentCharacter<CharacterType>(), current - currentCharacter<CharacterType>());
+            currentCharacter<CharacterType>() = current;
+            m_lineNumber = lineNumber;
+            m_token = LAZY_DECLARATION_BLOCK;
+            if (usesRemUnits && m_parser.m_styleSheet)
+                m_parser.m_styleSheet->parserSetUsesRemUnits(true);
+            return true;
+        case '(':
+        case '[':
+            ++bracketDepth;
+            break;
+        case ')':
+        case ']':
+            if (!bracketDepth)
+                return false;
+            --bracketDepth;
+            break;
+        case '\n':
+            ++lineNumber;
+            break;
+        case '\\':
+            if (current[1] == '\0' || current[1] == '\n')
+                return false;
+            ++current;
+            break;
+        case '-':
+            if (current[1] == '-' && current[2] == '>')
+                return false;
+            break;
+        case 'r':
+        case 'R':
+            // Mirrors the REMS token, which marks the sheet as using rem units.
+            if (isASCIIDigit(current[-1]) && isASCIIAlphaCaselessEqual(current[1], 'e') && isASCIIAlphaCaselessEqual(current[2], 'm'))
+                usesRemUnits = true;
+            break;
+        case '"':
+        case '\'': {
+            CharacterType quote = *current;
+            while (*++current != quote) {
+                if (*current == '\0' || *current == '\n' || *current == '\r' || *current == '\f')
+                    return false;
+                if (*current == '\\') {
+                    if (current[1] == '\0')
+                        return false;
+                    if (current[1] == '\n')
+                        ++lineNumber;
+                    ++current;
+                }
+            }
+            break;
+        }
+        case '/':
+            if (current[1] != '*')
+                break;
+            current += 2;
+            while (current[0] != '*' || current[1] != '/') {
+                if (*current == '\0')
+                    return false;
+                if (*current == '\n')
+                    ++lineNumber;
+                ++current;
+            }
+            ++current;
+            break;
+        }
+        ++current;
+    }
+}
+
 template <typename SrcCharacterType>
 int CSSTokenizer::realLex(void* yylvalWithoutType)
 {
@@ -1129,6 +1223,12 @@ int CSSTokenizer::realLex(void* yylvalWithoutType)
     yylval->string.clear();
 #endif
 
+    if (UNLIKELY(m_lexLazyDeclarationBlock)) {
+        m_lexLazyDeclarationBlock = false;
+        if (lexLazyDeclarationBlock<SrcCharacterType>(yylval->string))
+            return m_token;
+    }
+
 restartAfterComment:
     result = currentCharacter<SrcCharacterType>();
     setTokenStart(result);
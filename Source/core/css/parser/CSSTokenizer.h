@@ -50,6 +50,7 @@ public:
         , m_lineNumber(0)
         , m_tokenStartLineNumber(0)
         , m_internal(true)
+        , m_lexLazyDeclarationBlock(false)
     {
         m_tokenStart.ptr8 = 0;
     }
@@ -137,6 +138,8 @@ private:
     inline void detectAtToken(int, bool);
     template <typename CharacterType>
     inline void detectSupportsToken(int);
+    template <typename CharacterType>
+    inline bool lexLazyDeclarationBlock(CSSParserString&);
 
     template <typename SourceCharacterType>
     int realLex(void* yylval);
@@ -179,6 +182,10 @@ private:
     // with the CSSParserMode logic to determine if internal properties are allowed.
     bool m_internal;
 
+    // Set by the parser when the next token should be the unparsed text of a
+    // style rule's declaration block, see BisonCSSParser::startLazyDeclarationBlock().
+    bool m_lexLazyDeclarationBlock;
+
     int (CSSTokenizer::*m_lexFunc)(void*);
 };
 
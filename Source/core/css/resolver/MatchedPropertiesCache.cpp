@@ -74,11 +74,44 @@ void CachedMatchedProperties::set(const RenderStyle* style, const RenderStyle* p
     this->parentRenderStyle = RenderStyle::clone(parentStyle);
 }
 
+bool CachedMatchedProperties::addInheritedVariant(const RenderStyle* style, const RenderStyle* parentStyle)
+{
+    // Each variant holds a full style, so keep only a few parents per set of matched properties.
+    static const size_t maximumInheritedVariants = 3;
+
+    bool evicted = inheritedVariants.size() == maximumInheritedVariants;
+    if (evicted)
+        inheritedVariants.remove(0);
+
+    ComputedStyle variant;
+    variant.renderStyle = RenderStyle::clone(style);
+    variant.parentRenderStyle = RenderStyle::clone(parentStyle);
+    inheritedVariants.append(variant);
+    return evicted;
+}
+
+static bool inheritedPropertiesMatch(const RenderStyle* parentStyle, const RenderStyle* cachedParentStyle)
+{
+    return parentStyle->inheritedDataShared(cachedParentStyle) || !parentStyle->inheritedNotEqual(cachedParentStyle);
+}
+
+const RenderStyle* CachedMatchedProperties::findStyleForParent(const RenderStyle* parentStyle) const
+{
+    if (inheritedPropertiesMatch(parentStyle, parentRenderStyle.get()))
+        return renderStyle.get();
+    for (size_t i = inheritedVariants.size(); i; --i) {
+        if (inheritedPropertiesMatch(parentStyle, inheritedVariants[i - 1].parentRenderStyle.get()))
+            return inheritedVariants[i - 1].renderStyle.get();
+    }
+    return 0;
+}
+
 void CachedMatchedProperties::clear()
 {
     matchedProperties.clear();
     renderStyle = nullptr;
     parentRenderStyle = nullptr;
+    inheritedVariants.clear();
 }
 
 MatchedPropertiesCache::MatchedPropertiesCache()
@@ -113,7 +146,7 @@ const CachedMatchedProperties* MatchedPropertiesCache::find(unsigned hash, const
     return cacheItem;
 }
 
-void MatchedPropertiesCache::add(const RenderStyle* style, const RenderStyle* parentStyle, unsigned hash, const MatchResult& matchResult)
+bool MatchedPropertiesCache::add(const RenderStyle* style, const RenderStyle* parentStyle, unsigned hash, const MatchResult& matchResult)
 {
 #if !ENABLE(OILPAN)
     static const unsigned maxAdditionsBetweenSweeps = 100;
@@ -134,6 +167,17 @@ void MatchedPropertiesCache::add(const RenderStyle* style, const RenderStyle* pa
         cacheItem->clear();
 
     cacheItem->set(style, parentStyle, matchResult);
+    return !addResult.isNewEntry;
+}
+
+bool MatchedPropertiesCache::addInheritedVariant(unsigned hash, const RenderStyle* style, const RenderStyle* parentStyle)
+{
+    ASSERT(hash);
+    Cache::iterator it = m_cache.find(hash);
+    // Applying the inherited properties may have cleared the cache.
+    if (it == m_cache.end())
+        return false;
+    return it->value->addInheritedVariant(style, parentStyle);
 }
 
 void MatchedPropertiesCache::clear()
@@ -146,7 +190,10 @@ void MatchedPropertiesCache::clearViewportDependent()
     Vector<unsigned, 16> toRemove;
     for (Cache::iterator it = m_cache.begin(); it != m_cache.end(); ++it) {
         CachedMatchedProperties* cacheItem = it->value.get();
-        if (cacheItem->renderStyle->hasViewportUnits())
+        bool hasViewportUnits = cacheItem->renderStyle->hasViewportUnits();
+        for (size_t i = 0; i < cacheItem->inheritedVariants.size() && !hasViewportUnits; ++i)
+            hasViewportUnits = cacheItem->inheritedVariants[i].renderStyle->hasViewportUnits();
+        if (hasViewportUnits)
             toRemove.append(it->key);
     }
     m_cache.removeAll(toRemove);
@@ -39,12 +39,27 @@ class StyleResolverState;
 class CachedMatchedProperties FINAL : public NoBaseWillBeGarbageCollectedFinalized<CachedMatchedProperties> {
 
 public:
+    // A style computed from the matched properties, together with the parent style it
+    // inherited from.
+    struct ComputedStyle {
+        RefPtr<RenderStyle> renderStyle;
+        RefPtr<RenderStyle> parentRenderStyle;
+    };
+
     WillBeHeapVector<MatchedProperties> matchedProperties;
     MatchRanges ranges;
+    // The style the non-inherited properties are copied from when no parent matches.
     RefPtr<RenderStyle> renderStyle;
     RefPtr<RenderStyle> parentRenderStyle;
+    // Styles computed for other parents, oldest first.
+    Vector<ComputedStyle> inheritedVariants;
 
     void set(const RenderStyle*, const RenderStyle* parentStyle, const MatchResult&);
+    // Returns true if the oldest variant had to be evicted to make room.
+    bool addInheritedVariant(const RenderStyle*, const RenderStyle* parentStyle);
+    // Returns the cached style whose parent has the same inherited properties as the
+    // given parent, if any. Its inherited and non-inherited groups can both be reused.
+    const RenderStyle* findStyleForParent(const RenderStyle* parentStyle) const;
     void clear();
     void trace(Visitor* visitor) { visitor->trace(matchedProperties); }
 };
@@ -65,7 +80,11 @@ public:
     MatchedPropertiesCache();
 
     const CachedMatchedProperties* find(unsigned hash, const StyleResolverState&, const MatchResult&);
-    void add(const RenderStyle*, const RenderStyle* parentStyle, unsigned hash, const MatchResult&);
+    // Returns true if an existing entry or variant was evicted.
+    bool add(const RenderStyle*, const RenderStyle* parentStyle, unsigned hash, const MatchResult&);
+    // Records the style computed under a new parent for an entry returned by find()
+    // whose cached parents did not match. Returns true if an older variant was evicted.
+    bool addInheritedVariant(unsigned hash, const RenderStyle*, const RenderStyle* parentStyle);
 
     void clear();
     void clearViewportDependent();
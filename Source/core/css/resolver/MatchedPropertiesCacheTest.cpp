@@ -0,0 +1,137 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/css/resolver/MatchedPropertiesCache.h"
+
+#include "core/css/resolver/MatchResult.h"
+#include "core/css/resolver/StyleResolverState.h"
+#include "core/rendering/style/RenderStyle.h"
+#include "core/testing/DummyPageHolder.h"
+#include <gtest/gtest.h>
+
+using namespace blink;
+
+namespace {
+
+static const unsigned cacheHash = 1;
+
+class MatchedPropertiesCacheTest : public ::testing::Test {
+protected:
+    virtual void SetUp() OVERRIDE
+    {
+        m_dummyPageHolder = DummyPageHolder::create(IntSize(800, 600));
+    }
+
+    Document& document() const { return m_dummyPageHolder->document(); }
+
+    static PassRefPtr<RenderStyle> createStyleWithColor(const Color& color)
+    {
+        RefPtr<RenderStyle> style = RenderStyle::create();
+        style->setColor(color);
+        return style.release();
+    }
+
+    // Looks up the entry for the empty match result, as StyleResolver does for an element
+    // with the given parent.
+    const CachedMatchedProperties* find(MatchedPropertiesCache& cache, RenderStyle* parentStyle)
+    {
+        StyleResolverState state(document(), 0, parentStyle);
+        state.setStyle(RenderStyle::create());
+        MatchResult matchResult;
+        return cache.find(cacheHash, state, matchResult);
+    }
+
+private:
+    OwnPtr<DummyPageHolder> m_dummyPageHolder;
+};
+
+TEST_F(MatchedPropertiesCacheTest, InheritedVariantIsFoundForEqualParent)
+{
+    MatchedPropertiesCache cache;
+    MatchResult matchResult;
+    RefPtr<RenderStyle> redParent = createStyleWithColor(Color(255, 0, 0));
+    RefPtr<RenderStyle> redChild = createStyleWithColor(Color(255, 0, 0));
+    EXPECT_FALSE(cache.add(redChild.get(), redParent.get(), cacheHash, matchResult));
+
+    RefPtr<RenderStyle> blueParent = createStyleWithColor(Color(0, 0, 255));
+    const CachedMatchedProperties* entry = find(cache, blueParent.get());
+    ASSERT_TRUE(entry);
+    EXPECT_FALSE(entry->findStyleForParent(blueParent.get()));
+
+    RefPtr<RenderStyle> blueChild = createStyleWithColor(Color(0, 0, 255));
+    EXPECT_FALSE(cache.addInheritedVariant(cacheHash, blueChild.get(), blueParent.get()));
+
+    // A different parent with the same inherited properties hits the variant.
+    RefPtr<RenderStyle> otherBlueParent = createStyleWithColor(Color(0, 0, 255));
+    entry = find(cache, otherBlueParent.get());
+    ASSERT_TRUE(entry);
+    const RenderStyle* cachedStyle = entry->findStyleForParent(otherBlueParent.get());
+    ASSERT_TRUE(cachedStyle);
+    EXPECT_EQ(Color(0, 0, 255), cachedStyle->visitedDependentColor(CSSPropertyColor));
+
+    cachedStyle = entry->findStyleForParent(redParent.get());
+    ASSERT_TRUE(cachedStyle);
+    EXPECT_EQ(Color(255, 0, 0), cachedStyle->visitedDependentColor(CSSPropertyColor));
+}
+
+TEST_F(MatchedPropertiesCacheTest, OldestInheritedVariantIsEvicted)
+{
+    MatchedPropertiesCache cache;
+    MatchResult matchResult;
+    RefPtr<RenderStyle> parent = createStyleWithColor(Color(0, 0, 0));
+    cache.add(parent.get(), parent.get(), cacheHash, matchResult);
+
+    Vector<RefPtr<RenderStyle> > variantParents;
+    for (int i = 1; i <= 4; ++i) {
+        RefPtr<RenderStyle> variantParent = createStyleWithColor(Color(i, 0, 0));
+        variantParents.append(variantParent);
+        bool evicted = cache.addInheritedVariant(cacheHash, variantParent.get(), variantParent.get());
+        // Three variants fit, the fourth evicts the first.
+        EXPECT_EQ(i == 4, evicted);
+    }
+
+    const CachedMatchedProperties* entry = find(cache, parent.get());
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(3u, entry->inheritedVariants.size());
+    EXPECT_TRUE(entry->findStyleForParent(parent.get()));
+    EXPECT_FALSE(entry->findStyleForParent(variantParents[0].get()));
+    for (size_t i = 1; i < variantParents.size(); ++i)
+        EXPECT_TRUE(entry->findStyleForParent(variantParents[i].get()));
+
+    // Replacing the entry drops its variants.
+    EXPECT_TRUE(cache.add(parent.get(), parent.get(), cacheHash, matchResult));
+    entry = find(cache, parent.get());
+    ASSERT_TRUE(entry);
+    EXPECT_TRUE(entry->inheritedVariants.isEmpty());
+}
+
+TEST_F(MatchedPropertiesCacheTest, ClearViewportDependentRemovesEntryWithViewportDependentVariant)
+{
+    MatchedPropertiesCache cache;
+    MatchResult matchResult;
+    RefPtr<RenderStyle> parent = createStyleWithColor(Color(0, 0, 0));
+    cache.add(parent.get(), parent.get(), cacheHash, matchResult);
+
+    cache.clearViewportDependent();
+    EXPECT_TRUE(find(cache, parent.get()));
+
+    RefPtr<RenderStyle> variantParent = createStyleWithColor(Color(255, 0, 0));
+    RefPtr<RenderStyle> variant = createStyleWithColor(Color(255, 0, 0));
+    variant->setHasViewportUnits();
+    cache.addInheritedVariant(cacheHash, variant.get(), variantParent.get());
+
+    cache.clearViewportDependent();
+    EXPECT_FALSE(find(cache, parent.get()));
+}
+
+TEST_F(MatchedPropertiesCacheTest, AddInheritedVariantWithoutEntryDoesNothing)
+{
+    MatchedPropertiesCache cache;
+    RefPtr<RenderStyle> style = RenderStyle::create();
+    EXPECT_FALSE(cache.addInheritedVariant(cacheHash, style.get(), style.get()));
+    EXPECT_FALSE(find(cache, style.get()));
+}
+
+} // namespace
@@ -83,6 +83,7 @@
 #include "core/svg/SVGElement.h"
 #include "core/svg/SVGFontFaceElement.h"
 #include "platform/RuntimeEnabledFeatures.h"
+#include "wtf/BitArray.h"
 #include "wtf/StdLibExtras.h"
 
 namespace {
@@ -642,6 +643,10 @@ PassRefPtr<RenderStyle> StyleResolver::styleForElement(Element* element, RenderS
     if (state.style()->hasViewportUnits())
         document().setHasViewportUnits();
 
+    // Groups copied after the style was added to the matched properties cache, or of styles
+    // that aren't cached.
+    state.style()->internData(m_styleDataInterners);
+
     // Now return the style.
     return state.takeStyle();
 }
@@ -1309,6 +1314,34 @@ void StyleResolver::applyAllProperty(StyleResolverState& state, CSSValue* allVal
     }
 }
 
+template <StyleResolver::StyleApplicationPass pass>
+bool StyleResolver::shouldApplyProperty(const StylePropertySet::PropertyReference& current, bool inheritedOnly, PropertyWhitelistType propertyWhitelistType)
+{
+    if (inheritedOnly && !current.isInherited()) {
+        // If the property value is explicitly inherited, we need to apply further non-inherited properties
+        // as they might override the value inherited here. For this reason we don't allow declarations with
+        // explicitly inherited properties to be cached.
+        ASSERT(!current.value()->isInheritedValue());
+        return false;
+    }
+
+    CSSPropertyID property = current.id();
+    if (propertyWhitelistType == PropertyWhitelistCue && !isValidCueStyleProperty(property))
+        return false;
+    if (propertyWhitelistType == PropertyWhitelistFirstLetter && !isValidFirstLetterStyleProperty(property))
+        return false;
+    return isPropertyForPass<pass>(property);
+}
+
+template <StyleResolver::StyleApplicationPass pass>
+void StyleResolver::applyProperty(StyleResolverState& state, CSSPropertyID property, CSSValue* value)
+{
+    if (pass == HighPriorityProperties && property == CSSPropertyLineHeight)
+        state.setLineHeightValue(value);
+    else
+        StyleBuilder::applyProperty(property, state, value);
+}
+
 template <StyleResolver::StyleApplicationPass pass>
 void StyleResolver::applyProperties(StyleResolverState& state, const StylePropertySet* properties, bool isImportant, bool inheritedOnly, PropertyWhitelistType propertyWhitelistType)
 {
@@ -1324,25 +1357,78 @@ void StyleResolver::applyProperties(StyleResolverState& state, const StyleProper
             continue;
         }
 
-        if (inheritedOnly && !current.isInherited()) {
-            // If the property value is explicitly inherited, we need to apply further non-inherited properties
-            // as they might override the value inherited here. For this reason we don't allow declarations with
-            // explicitly inherited properties to be cached.
-            ASSERT(!current.value()->isInheritedValue());
+        if (!shouldApplyProperty<pass>(current, inheritedOnly, propertyWhitelistType))
             continue;
-        }
+        applyProperty<pass>(state, property, current.value());
+    }
+}
 
-        if (propertyWhitelistType == PropertyWhitelistCue && !isValidCueStyleProperty(property))
-            continue;
-        if (propertyWhitelistType == PropertyWhitelistFirstLetter && !isValidFirstLetterStyleProperty(property))
-            continue;
-        if (!isPropertyForPass<pass>(property))
-            continue;
-        if (pass == HighPriorityProperties && property == CSSPropertyLineHeight)
-            state.setLineHeightValue(current.value());
-        else
-            StyleBuilder::applyProperty(current.id(), state, current.value());
+// A later declaration of these properties doesn't simply override an earlier one, as applying them
+// may leave what earlier declarations set alone:
+// - The initial value of counter-increment and counter-reset leaves the directives set by earlier
+//   declarations alone and inherit adds the parent's directives to them.
+// - -webkit-border-image sets the border widths only when its border slices are fixed lengths.
+// - grid-template-areas: none is ignored, and the named grid lines other areas imply are kept.
+// - text-align: <string> is ignored.
+// - zoom: 0 leaves the zoom set earlier.
+static inline bool isOverriddenByLaterDeclaration(CSSPropertyID property)
+{
+    switch (property) {
+    case CSSPropertyCounterIncrement:
+    case CSSPropertyCounterReset:
+    case CSSPropertyWebkitBorderImage:
+    case CSSPropertyGridTemplateAreas:
+    case CSSPropertyTextAlign:
+    case CSSPropertyZoom:
+        return false;
+    default:
+        return true;
+    }
+}
+
+// Applies only the last declaration of each property in the given range of matched properties.
+// Declarations overridden later in the same cascade level cannot affect the result, so there is
+// no need to convert their values and write them to the style, which may also copy a shared data
+// group for nothing. Returns false without applying anything if the range contains the 'all'
+// property, which overrides other properties by position and is applied in order instead. Every
+// declaration of the properties isOverriddenByLaterDeclaration() excludes is applied.
+template <StyleResolver::StyleApplicationPass pass>
+bool StyleResolver::applyOverridingProperties(StyleResolverState& state, const MatchResult& matchResult, bool isImportant, int startIndex, int endIndex, bool inheritedOnly)
+{
+    BitArray<numCSSProperties> seenProperties;
+    Vector<std::pair<CSSPropertyID, CSSValue*>, 64> overridingProperties;
+
+    for (int i = endIndex; i >= startIndex; --i) {
+        const MatchedProperties& matchedProperties = matchResult.matchedProperties[i];
+        const StylePropertySet* properties = matchedProperties.properties.get();
+        PropertyWhitelistType propertyWhitelistType = static_cast<PropertyWhitelistType>(matchedProperties.m_types.whitelistType);
+        for (unsigned j = properties->propertyCount(); j; --j) {
+            StylePropertySet::PropertyReference current = properties->propertyAt(j - 1);
+            if (isImportant != current.isImportant())
+                continue;
+
+            CSSPropertyID property = current.id();
+            if (property == CSSPropertyAll)
+                return false;
+            if (!shouldApplyProperty<pass>(current, inheritedOnly, propertyWhitelistType))
+                continue;
+
+            if (isOverriddenByLaterDeclaration(property)) {
+                unsigned index = property - firstCSSProperty;
+                if (seenProperties.get(index)) {
+                    INCREMENT_STYLE_STATS_COUNTER(*this, matchedPropertyOverridden);
+                    continue;
+                }
+                seenProperties.set(index);
+            }
+            overridingProperties.append(std::make_pair(property, current.value()));
+        }
     }
+
+    // Apply in cascade order, as some properties are resolved against the ones applied before them.
+    for (size_t i = overridingProperties.size(); i; --i)
+        applyProperty<pass>(state, overridingProperties[i - 1].first, overridingProperties[i - 1].second);
+    return true;
 }
 
 template <StyleResolver::StyleApplicationPass pass>
@@ -1365,6 +1451,8 @@ void StyleResolver::applyMatchedProperties(StyleResolverState& state, const Matc
         state.setApplyPropertyToVisitedLinkStyle(false);
         return;
     }
+    if (startIndex < endIndex && applyOverridingProperties<pass>(state, matchResult, isImportant, startIndex, endIndex, inheritedOnly))
+        return;
     for (int i = startIndex; i <= endIndex; ++i) {
         const MatchedProperties& matchedProperties = matchResult.matchedProperties[i];
         applyProperties<pass>(state, matchedProperties.properties.get(), isImportant, inheritedOnly, static_cast<PropertyWhitelistType>(matchedProperties.m_types.whitelistType));
@@ -1379,6 +1467,7 @@ static unsigned computeMatchedPropertiesHash(const MatchedProperties* properties
 void StyleResolver::invalidateMatchedPropertiesCache()
 {
     m_matchedPropertiesCache.clear();
+    m_styleDataInterners.clear();
 }
 
 void StyleResolver::notifyResizeForViewportUnits()
@@ -1396,28 +1485,36 @@ void StyleResolver::applyMatchedProperties(StyleResolverState& state, const Matc
 
     unsigned cacheHash = matchResult.isCacheable ? computeMatchedPropertiesHash(matchResult.matchedProperties.data(), matchResult.matchedProperties.size()) : 0;
     bool applyInheritedOnly = false;
+    bool addInheritedVariant = false;
     const CachedMatchedProperties* cachedMatchedProperties = cacheHash ? m_matchedPropertiesCache.find(cacheHash, state, matchResult) : 0;
+    if (cacheHash && !cachedMatchedProperties)
+        INCREMENT_STYLE_STATS_COUNTER(*this, matchedPropertyCacheMiss);
 
     if (cachedMatchedProperties && MatchedPropertiesCache::isCacheable(element, state.style(), state.parentStyle())) {
         INCREMENT_STYLE_STATS_COUNTER(*this, matchedPropertyCacheHit);
-        // We can build up the style by copying non-inherited properties from an earlier style object built using the same exact
-        // style declarations. We then only need to apply the inherited properties, if any, as their values can depend on the
-        // element context. This is fast and saves memory by reusing the style data structures.
-        state.style()->copyNonInheritedFrom(cachedMatchedProperties->renderStyle.get());
-        if (state.parentStyle()->inheritedDataShared(cachedMatchedProperties->parentRenderStyle.get()) && !isAtShadowBoundary(element)
-            && (!state.distributedToInsertionPoint() || state.style()->userModify() == READ_ONLY)) {
+        const RenderStyle* cachedStyle = 0;
+        if (!isAtShadowBoundary(element) && (!state.distributedToInsertionPoint() || state.style()->userModify() == READ_ONLY))
+            cachedStyle = cachedMatchedProperties->findStyleForParent(state.parentStyle());
+        if (cachedStyle) {
             INCREMENT_STYLE_STATS_COUNTER(*this, matchedPropertyCacheInheritedHit);
 
             EInsideLink linkStatus = state.style()->insideLink();
-            // If the cache item parent style has identical inherited properties to the current parent style then the
-            // resulting style will be identical too. We copy the inherited properties over from the cache and are done.
-            state.style()->inheritFrom(cachedMatchedProperties->renderStyle.get());
+            // If a cached style was built under a parent with identical inherited properties to the current parent style
+            // then the resulting style will be identical too. We copy both property groups over from the cache and are done.
+            state.style()->copyNonInheritedFrom(cachedStyle);
+            state.style()->inheritFrom(cachedStyle);
 
             // Unfortunately the link status is treated like an inherited property. We need to explicitly restore it.
             state.style()->setInsideLink(linkStatus);
             return;
         }
+
+        // We can build up the style by copying non-inherited properties from an earlier style object built using the same exact
+        // style declarations. We then only need to apply the inherited properties, if any, as their values can depend on the
+        // element context. This is fast and saves memory by reusing the style data structures.
+        state.style()->copyNonInheritedFrom(cachedMatchedProperties->renderStyle.get());
         applyInheritedOnly = true;
+        addInheritedVariant = !isAtShadowBoundary(element) && !state.distributedToInsertionPoint();
     }
 
     // Now we have all of the matched rules in the appropriate order. Walk the rules and apply
@@ -1471,7 +1568,15 @@ void StyleResolver::applyMatchedProperties(StyleResolverState& state, const Matc
 
     if (!cachedMatchedProperties && cacheHash && MatchedPropertiesCache::isCacheable(element, state.style(), state.parentStyle())) {
         INCREMENT_STYLE_STATS_COUNTER(*this, matchedPropertyCacheAdded);
-        m_matchedPropertiesCache.add(state.style(), state.parentStyle(), cacheHash, matchResult);
+        // The cache shares the groups copied for this style from now on, so intern them first.
+        state.style()->internData(m_styleDataInterners);
+        if (m_matchedPropertiesCache.add(state.style(), state.parentStyle(), cacheHash, matchResult))
+            INCREMENT_STYLE_STATS_COUNTER(*this, matchedPropertyCacheEvicted);
+    } else if (addInheritedVariant && MatchedPropertiesCache::isCacheable(element, state.style(), state.parentStyle())) {
+        INCREMENT_STYLE_STATS_COUNTER(*this, matchedPropertyCacheInheritedVariantAdded);
+        state.style()->internData(m_styleDataInterners);
+        if (m_matchedPropertiesCache.addInheritedVariant(cacheHash, state.style(), state.parentStyle()))
+            INCREMENT_STYLE_STATS_COUNTER(*this, matchedPropertyCacheEvicted);
     }
 
     ASSERT(!state.fontBuilder().fontDirty());
@@ -1528,6 +1633,7 @@ void StyleResolver::printStats()
     fprintf(stderr, "%s\n", m_styleResolverStats->report().utf8().data());
     fprintf(stderr, "== Totals ==\n");
     fprintf(stderr, "%s\n", m_styleResolverStatsTotals->report().utf8().data());
+    fprintf(stderr, "%s\n", m_styleDataInterners.report().utf8().data());
 }
 
 void StyleResolver::applyPropertiesToStyle(const CSSPropertyValue* properties, size_t count, RenderStyle* style)
@@ -33,6 +33,7 @@
 #include "core/css/resolver/ScopedStyleResolver.h"
 #include "core/css/resolver/StyleBuilder.h"
 #include "core/css/resolver/StyleResourceLoader.h"
+#include "core/rendering/style/RenderStyle.h"
 #include "platform/heap/Handle.h"
 #include "wtf/Deque.h"
 #include "wtf/HashMap.h"
@@ -248,8 +249,14 @@ private:
     template <StyleApplicationPass pass>
     void applyMatchedProperties(StyleResolverState&, const MatchResult&, bool important, int startIndex, int endIndex, bool inheritedOnly);
     template <StyleApplicationPass pass>
+    bool applyOverridingProperties(StyleResolverState&, const MatchResult&, bool important, int startIndex, int endIndex, bool inheritedOnly);
+    template <StyleApplicationPass pass>
     void applyProperties(StyleResolverState&, const StylePropertySet* properties, bool isImportant, bool inheritedOnly, PropertyWhitelistType = PropertyWhitelistNone);
     template <StyleApplicationPass pass>
+    static inline bool shouldApplyProperty(const StylePropertySet::PropertyReference&, bool inheritedOnly, PropertyWhitelistType);
+    template <StyleApplicationPass pass>
+    static inline void applyProperty(StyleResolverState&, CSSPropertyID, CSSValue*);
+    template <StyleApplicationPass pass>
     void applyAnimatedProperties(StyleResolverState&, const WillBeHeapHashMap<CSSPropertyID, RefPtrWillBeMember<Interpolation> >&);
     template <StyleResolver::StyleApplicationPass pass>
     void applyAllProperty(StyleResolverState&, CSSValue*);
@@ -274,6 +281,7 @@ private:
     void cacheBorderAndBackground();
 
     MatchedPropertiesCache m_matchedPropertiesCache;
+    StyleDataInterners m_styleDataInterners;
 
     OwnPtr<MediaQueryEvaluator> m_medium;
     MediaQueryResultList m_viewportDependentMediaQueryResults;
@@ -49,8 +49,12 @@ void StyleResolverStats::reset()
     sharedStyleRejectedByParent = 0;
     matchedPropertyApply = 0;
     matchedPropertyCacheHit = 0;
+    matchedPropertyCacheMiss = 0;
     matchedPropertyCacheInheritedHit = 0;
     matchedPropertyCacheAdded = 0;
+    matchedPropertyCacheInheritedVariantAdded = 0;
+    matchedPropertyCacheEvicted = 0;
+    matchedPropertyOverridden = 0;
 }
 
 String StyleResolverStats::report() const
@@ -78,8 +82,12 @@ String StyleResolverStats::report() const
 
     output.appendLiteral("Matched property cache:\n");
     output.append(String::format("  %u calls to applyMatchedProperties, %u hit the cache (%.2f%%).\n", matchedPropertyApply, matchedPropertyCacheHit, PERCENT(matchedPropertyCacheHit, matchedPropertyApply)));
+    output.append(String::format("  %u cacheable calls missed the cache (%.2f%%).\n", matchedPropertyCacheMiss, PERCENT(matchedPropertyCacheMiss, matchedPropertyApply)));
     output.append(String::format("  %u cache hits also shared the inherited style (%.2f%%).\n", matchedPropertyCacheInheritedHit, PERCENT(matchedPropertyCacheInheritedHit, matchedPropertyCacheHit)));
     output.append(String::format("  %u styles created in applyMatchedProperties were added to the cache (%.2f%%).\n", matchedPropertyCacheAdded, PERCENT(matchedPropertyCacheAdded, matchedPropertyApply)));
+    output.append(String::format("  %u styles were added to cache entries for a new parent style (%.2f%%).\n", matchedPropertyCacheInheritedVariantAdded, PERCENT(matchedPropertyCacheInheritedVariantAdded, matchedPropertyApply)));
+    output.append(String::format("  %u cache entries or parent variants were evicted.\n", matchedPropertyCacheEvicted));
+    output.append(String::format("  %u declarations were skipped as later ones in the cascade override them.\n", matchedPropertyOverridden));
 
     return output.toString();
 }
@@ -55,8 +55,12 @@ public:
     unsigned sharedStyleRejectedByParent;
     unsigned matchedPropertyApply;
     unsigned matchedPropertyCacheHit;
+    unsigned matchedPropertyCacheMiss;
     unsigned matchedPropertyCacheInheritedHit;
     unsigned matchedPropertyCacheAdded;
+    unsigned matchedPropertyCacheInheritedVariantAdded;
+    unsigned matchedPropertyCacheEvicted;
+    unsigned matchedPropertyOverridden;
 
     // We keep a separate flag for this since crawling the entire document to print
     // the number of missed candidates is very slow.
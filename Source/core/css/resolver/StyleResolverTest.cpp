@@ -0,0 +1,104 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/css/resolver/StyleResolver.h"
+
+#include "bindings/core/v8/ExceptionStatePlaceholder.h"
+#include "core/dom/Document.h"
+#include "core/dom/Element.h"
+#include "core/html/HTMLElement.h"
+#include "core/rendering/style/CounterDirectives.h"
+#include "core/rendering/style/RenderStyle.h"
+#include "core/testing/DummyPageHolder.h"
+#include <gtest/gtest.h>
+
+using namespace blink;
+
+namespace {
+
+class StyleResolverTest : public ::testing::Test {
+protected:
+    virtual void SetUp() OVERRIDE
+    {
+        m_dummyPageHolder = DummyPageHolder::create(IntSize(800, 600));
+    }
+
+    Document& document() const { return m_dummyPageHolder->document(); }
+
+    const RenderStyle* computedStyle(const char* id)
+    {
+        document().updateRenderTreeIfNeeded();
+        Element* element = document().getElementById(AtomicString(id));
+        return element ? element->renderStyle() : 0;
+    }
+
+private:
+    OwnPtr<DummyPageHolder> m_dummyPageHolder;
+};
+
+TEST_F(StyleResolverTest, LaterDeclarationOverridesEarlierOne)
+{
+    document().body()->setInnerHTML("<style>.a { width: 10px } .b { width: 20px }</style>"
+        "<div id='target' class='a b'></div>", ASSERT_NO_EXCEPTION);
+    const RenderStyle* style = computedStyle("target");
+    ASSERT_TRUE(style);
+    EXPECT_EQ(Length(20, Fixed), style->width());
+}
+
+TEST_F(StyleResolverTest, InheritedCounterIncrementAddsToEarlierDeclaration)
+{
+    document().body()->setInnerHTML("<style>#parent { counter-increment: y 2 } .a { counter-increment: x 1 } .b { counter-increment: inherit }</style>"
+        "<div id='parent'><div id='target' class='a b'></div></div>", ASSERT_NO_EXCEPTION);
+    const RenderStyle* style = computedStyle("target");
+    ASSERT_TRUE(style);
+    const CounterDirectiveMap* directives = style->counterDirectives();
+    ASSERT_TRUE(directives);
+
+    CounterDirectiveMap::const_iterator x = directives->find(AtomicString("x"));
+    ASSERT_NE(directives->end(), x);
+    EXPECT_TRUE(x->value.isIncrement());
+    EXPECT_EQ(1, x->value.incrementValue());
+
+    CounterDirectiveMap::const_iterator y = directives->find(AtomicString("y"));
+    ASSERT_NE(directives->end(), y);
+    EXPECT_TRUE(y->value.isIncrement());
+    EXPECT_EQ(2, y->value.incrementValue());
+}
+
+TEST_F(StyleResolverTest, InitialCounterResetKeepsEarlierDeclaration)
+{
+    document().body()->setInnerHTML("<style>.a { counter-reset: x 3 } .b { counter-reset: initial }</style>"
+        "<div id='target' class='a b'></div>", ASSERT_NO_EXCEPTION);
+    const RenderStyle* style = computedStyle("target");
+    ASSERT_TRUE(style);
+    const CounterDirectiveMap* directives = style->counterDirectives();
+    ASSERT_TRUE(directives);
+
+    CounterDirectiveMap::const_iterator x = directives->find(AtomicString("x"));
+    ASSERT_NE(directives->end(), x);
+    EXPECT_TRUE(x->value.isReset());
+    EXPECT_EQ(3, x->value.resetValue());
+}
+
+TEST_F(StyleResolverTest, WebkitBorderImageWithoutWidthsKeepsEarlierWidths)
+{
+    document().body()->setInnerHTML("<style>.a { border-top: solid 3px; -webkit-border-image: linear-gradient(green, green) 10 / 10px }"
+        " .b { -webkit-border-image: linear-gradient(green, green) 10 }</style>"
+        "<div id='target' class='a b'></div>", ASSERT_NO_EXCEPTION);
+    const RenderStyle* style = computedStyle("target");
+    ASSERT_TRUE(style);
+    EXPECT_EQ(10u, style->borderTopWidth());
+}
+
+TEST_F(StyleResolverTest, IgnoredZoomKeepsEarlierDeclaration)
+{
+    document().body()->setInnerHTML("<style>.a { zoom: 2 } .b { zoom: 0 }</style>"
+        "<div id='target' class='a b'></div>", ASSERT_NO_EXCEPTION);
+    const RenderStyle* style = computedStyle("target");
+    ASSERT_TRUE(style);
+    EXPECT_EQ(2, style->zoom());
+}
+
+} // namespace
@@ -50,6 +50,8 @@ public:
 
     bool elementMatches(const Element&) const;
 
+    const SpaceSplitString& classNames() const { return m_classNames; }
+
 private:
     ClassCollection(ContainerNode& rootNode, const AtomicString& classNames);
 
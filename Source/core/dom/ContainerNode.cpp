@@ -845,7 +845,13 @@ void ContainerNode::childrenChanged(const ChildrenChange& change)
     document().incDOMTreeVersion();
     if (!change.byParser && change.type != TextChanged)
         document().updateRangesAfterChildrenChanged(this);
-    invalidateNodeListCachesInAncestors();
+    if (change.isChildElementChange() || change.type == AllChildrenRemoved) {
+        invalidateNodeListCachesInAncestors();
+    } else if (change.type != TextChanged) {
+        // All LiveNodeLists other than ChildNodeList only contain elements, so
+        // inserting or removing text and comment nodes can't affect them.
+        invalidateChildNodeListCache();
+    }
     if (change.isChildInsertion() && !childNeedsStyleRecalc()) {
         setChildNeedsStyleRecalc();
         markAncestorsWithChildNeedsStyleRecalc();
@@ -1340,14 +1346,20 @@ void ContainerNode::checkForSiblingStyleChanges(SiblingCheckType changeType, Nod
     }
 }
 
-void ContainerNode::invalidateNodeListCachesInAncestors(const QualifiedName* attrName, Element* attributeOwnerElement)
+void ContainerNode::invalidateChildNodeListCache()
 {
-    if (hasRareData() && (!attrName || isAttributeNode())) {
-        if (NodeListsNodeData* lists = rareData()->nodeLists()) {
-            if (ChildNodeList* childNodeList = lists->childNodeList(*this))
-                childNodeList->invalidateCache();
-        }
+    if (!hasRareData())
+        return;
+    if (NodeListsNodeData* lists = rareData()->nodeLists()) {
+        if (ChildNodeList* childNodeList = lists->childNodeList(*this))
+            childNodeList->invalidateCache();
     }
+}
+
+void ContainerNode::invalidateNodeListCachesInAncestors(const QualifiedName* attrName, Element* attributeOwnerElement)
+{
+    if (!attrName || isAttributeNode())
+        invalidateChildNodeListCache();
 
     // Modifications to attributes that are not associated with an Element can't invalidate NodeList caches.
     if (attrName && !attributeOwnerElement)
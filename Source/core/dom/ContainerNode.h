@@ -204,6 +204,7 @@ protected:
     ContainerNode(TreeScope*, ConstructionType = CreateContainer);
 
     void invalidateNodeListCachesInAncestors(const QualifiedName* attrName = 0, Element* attributeOwnerElement = 0);
+    void invalidateChildNodeListCache();
 
 #if !ENABLE(OILPAN)
     void removeDetachedChildren();
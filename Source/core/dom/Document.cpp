@@ -64,6 +64,7 @@
 #include "core/dom/Comment.h"
 #include "core/dom/ContextFeatures.h"
 #include "core/dom/DOMImplementation.h"
+#include "core/dom/DocumentElementIndex.h"
 #include "core/dom/DocumentFragment.h"
 #include "core/dom/DocumentLifecycleNotifier.h"
 #include "core/dom/DocumentLifecycleObserver.h"
@@ -656,6 +657,7 @@ void Document::dispose()
     // removeDetachedChildren() doesn't always unregister IDs,
     // so tear down scope information upfront to avoid having stale references in the map.
     destroyTreeScopeData();
+    m_elementIndex.clear();
 
     removeDetachedChildren();
 
@@ -686,6 +688,13 @@ SelectorQueryCache& Document::selectorQueryCache()
     return *m_selectorQueryCache;
 }
 
+DocumentElementIndex& Document::ensureElementIndex()
+{
+    if (!m_elementIndex)
+        m_elementIndex = DocumentElementIndex::create(*this);
+    return *m_elementIndex;
+}
+
 MediaQueryMatcher& Document::mediaQueryMatcher()
 {
     if (!m_mediaQueryMatcher)
@@ -5798,6 +5807,7 @@ void Document::trace(Visitor* visitor)
     visitor->trace(m_documentElement);
     visitor->trace(m_titleElement);
     visitor->trace(m_markers);
+    visitor->trace(m_elementIndex);
     visitor->trace(m_cssTarget);
     visitor->trace(m_currentScriptStack);
     visitor->trace(m_scriptRunner);
@@ -75,6 +75,7 @@ class ContextFeatures;
 class CustomElementMicrotaskRunQueue;
 class CustomElementRegistrationContext;
 class DOMImplementation;
+class DocumentElementIndex;
 class DocumentFragment;
 class DocumentLifecycleNotifier;
 class DocumentLoader;
@@ -240,6 +241,10 @@ public:
 
     SelectorQueryCache& selectorQueryCache();
 
+    // Only exists once a collection has asked for it, see DocumentElementIndex.
+    DocumentElementIndex* elementIndex() const { return m_elementIndex.get(); }
+    DocumentElementIndex& ensureElementIndex();
+
     // Focus Management.
     Element* activeElement() const;
     bool hasFocus() const;
@@ -1295,6 +1300,7 @@ private:
     WillBeHeapHashMap<String, RefPtrWillBeMember<HTMLCanvasElement> > m_cssCanvasElements;
 
     OwnPtr<SelectorQueryCache> m_selectorQueryCache;
+    OwnPtrWillBeMember<DocumentElementIndex> m_elementIndex;
 
     bool m_useSecureKeyboardEntryWhenActive;
 
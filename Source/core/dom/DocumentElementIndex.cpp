@@ -0,0 +1,132 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/dom/DocumentElementIndex.h"
+
+#include "core/dom/Document.h"
+#include "core/dom/Element.h"
+#include "core/dom/ElementTraversal.h"
+#include "core/dom/SpaceSplitString.h"
+#include "platform/TraceEvent.h"
+#include <algorithm>
+
+namespace blink {
+
+static bool precedesInDocumentOrder(const RawPtrWillBeMember<Element>& a, const RawPtrWillBeMember<Element>& b)
+{
+    return a->compareDocumentPosition(b.get()) & Node::DOCUMENT_POSITION_FOLLOWING;
+}
+
+PassOwnPtrWillBeRawPtr<DocumentElementIndex> DocumentElementIndex::create(Document& document)
+{
+    TRACE_EVENT0("blink", "DocumentElementIndex::create");
+    OwnPtrWillBeRawPtr<DocumentElementIndex> index = adoptPtrWillBeNoop(new DocumentElementIndex());
+    // Elements are visited in document order, so every list starts out ordered.
+    for (Element* element = ElementTraversal::firstWithin(document); element; element = ElementTraversal::next(*element))
+        index->addElement(*element);
+    return index.release();
+}
+
+void DocumentElementIndex::addElement(Element& element)
+{
+    add(m_localNameMap, element.localName(), element);
+    if (!element.hasClass())
+        return;
+    const SpaceSplitString& classNames = element.classNames();
+    for (size_t i = 0; i < classNames.size(); ++i)
+        add(m_classMap, classNames[i], element);
+}
+
+void DocumentElementIndex::removeElement(Element& element)
+{
+    remove(m_localNameMap, element.localName(), element);
+    if (!element.hasClass())
+        return;
+    const SpaceSplitString& classNames = element.classNames();
+    for (size_t i = 0; i < classNames.size(); ++i)
+        remove(m_classMap, classNames[i], element);
+}
+
+void DocumentElementIndex::classesChanged(Element& element, const SpaceSplitString& oldClasses, const SpaceSplitString& newClasses)
+{
+    for (size_t i = 0; i < oldClasses.size(); ++i) {
+        if (!newClasses.contains(oldClasses[i]))
+            remove(m_classMap, oldClasses[i], element);
+    }
+    for (size_t i = 0; i < newClasses.size(); ++i)
+        add(m_classMap, newClasses[i], element);
+}
+
+const DocumentElementIndex::ElementList* DocumentElementIndex::elementsWithLocalName(const AtomicString& localName)
+{
+    return elementsInDocumentOrder(m_localNameMap, localName);
+}
+
+const DocumentElementIndex::ElementList* DocumentElementIndex::elementsWithClass(const AtomicString& className)
+{
+    return elementsInDocumentOrder(m_classMap, className);
+}
+
+void DocumentElementIndex::add(Map& map, const AtomicString& key, Element& element)
+{
+    Map::AddResult addResult = map.add(key, nullptr);
+    if (addResult.isNewEntry)
+        addResult.storedValue->value = adoptPtrWillBeNoop(new Entry);
+    Entry& entry = *addResult.storedValue->value;
+    if (entry.elements.contains(&element))
+        return;
+    // Elements are mostly added in document order, by the parser or by
+    // inserting a subtree, so only the last element needs to be compared.
+    if (entry.isInDocumentOrder && !entry.elements.isEmpty() && !precedesInDocumentOrder(entry.elements.last(), &element))
+        entry.isInDocumentOrder = false;
+    entry.elements.add(&element);
+}
+
+void DocumentElementIndex::remove(Map& map, const AtomicString& key, Element& element)
+{
+    Map::iterator it = map.find(key);
+    if (it == map.end())
+        return;
+    Entry& entry = *it->value;
+    entry.elements.remove(&element);
+    if (entry.elements.isEmpty())
+        map.remove(it);
+}
+
+const DocumentElementIndex::ElementList* DocumentElementIndex::elementsInDocumentOrder(Map& map, const AtomicString& key)
+{
+    Map::iterator it = map.find(key);
+    if (it == map.end())
+        return 0;
+    Entry& entry = *it->value;
+    if (!entry.isInDocumentOrder) {
+        TRACE_EVENT0("blink", "DocumentElementIndex::sort");
+        WillBeHeapVector<RawPtrWillBeMember<Element> > elements;
+        copyToVector(entry.elements, elements);
+        std::sort(elements.begin(), elements.end(), precedesInDocumentOrder);
+        entry.elements.clear();
+        for (size_t i = 0; i < elements.size(); ++i)
+            entry.elements.add(elements[i]);
+        entry.isInDocumentOrder = true;
+    }
+    return &entry.elements;
+}
+
+void DocumentElementIndex::Entry::trace(Visitor* visitor)
+{
+#if ENABLE(OILPAN)
+    visitor->trace(elements);
+#endif
+}
+
+void DocumentElementIndex::trace(Visitor* visitor)
+{
+#if ENABLE(OILPAN)
+    visitor->trace(m_localNameMap);
+    visitor->trace(m_classMap);
+#endif
+}
+
+} // namespace blink
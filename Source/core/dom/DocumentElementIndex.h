@@ -0,0 +1,72 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef DocumentElementIndex_h
+#define DocumentElementIndex_h
+
+#include "platform/heap/Handle.h"
+#include "wtf/HashMap.h"
+#include "wtf/ListHashSet.h"
+#include "wtf/Noncopyable.h"
+#include "wtf/text/AtomicString.h"
+#include "wtf/text/AtomicStringHash.h"
+
+namespace blink {
+
+class Document;
+class Element;
+class SpaceSplitString;
+
+// Maps local names and class names to the elements of a document's own tree
+// that have them, so that document-rooted TagCollections and ClassCollections
+// can be rebuilt without traversing the document. Shadow trees are not
+// indexed.
+//
+// The index is only built when the ElementCollectionIndex runtime feature is
+// enabled and a collection asks for it, and is updated incrementally from
+// then on. Elements inserted anywhere but after the last element of a list
+// leave that list unordered until it is next asked for.
+class DocumentElementIndex : public NoBaseWillBeGarbageCollected<DocumentElementIndex> {
+    WTF_MAKE_NONCOPYABLE(DocumentElementIndex);
+public:
+    typedef WillBeHeapListHashSet<RawPtrWillBeMember<Element> > ElementList;
+
+    static PassOwnPtrWillBeRawPtr<DocumentElementIndex> create(Document&);
+
+    void addElement(Element&);
+    void removeElement(Element&);
+    void classesChanged(Element&, const SpaceSplitString& oldClasses, const SpaceSplitString& newClasses);
+
+    // Return the elements in document order, or 0 if there are none.
+    const ElementList* elementsWithLocalName(const AtomicString&);
+    const ElementList* elementsWithClass(const AtomicString&);
+
+    void trace(Visitor*);
+
+private:
+    class Entry : public NoBaseWillBeGarbageCollected<Entry> {
+    public:
+        Entry() : isInDocumentOrder(true) { }
+
+        void trace(Visitor*);
+
+        ElementList elements;
+        bool isInDocumentOrder;
+    };
+
+    typedef WillBeHeapHashMap<AtomicString, OwnPtrWillBeMember<Entry> > Map;
+
+    DocumentElementIndex() { }
+
+    static void add(Map&, const AtomicString& key, Element&);
+    static void remove(Map&, const AtomicString& key, Element&);
+    static const ElementList* elementsInDocumentOrder(Map&, const AtomicString& key);
+
+    Map m_localNameMap;
+    Map m_classMap;
+};
+
+} // namespace blink
+
+#endif // DocumentElementIndex_h
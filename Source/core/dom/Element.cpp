@@ -52,6 +52,7 @@
 #include "core/dom/ClientRect.h"
 #include "core/dom/ClientRectList.h"
 #include "core/dom/DatasetDOMStringMap.h"
+#include "core/dom/DocumentElementIndex.h"
 #include "core/dom/ElementDataCache.h"
 #include "core/dom/ElementRareData.h"
 #include "core/dom/ElementTraversal.h"
@@ -954,6 +955,7 @@ void Element::attributeChanged(const QualifiedName& name, const AtomicString& ne
 
     StyleResolver* styleResolver = document().styleResolver();
     bool testShouldInvalidateStyle = inActiveDocument() && styleResolver && styleChangeType() < SubtreeStyleChange;
+    bool shouldInvalidateNodeLists = true;
 
     if (isStyledElement() && name == styleAttr) {
         styleAttributeChanged(newValue, reason);
@@ -971,12 +973,17 @@ void Element::attributeChanged(const QualifiedName& name, const AtomicString& ne
                 styleResolver->ensureUpdatedRuleFeatureSet().scheduleStyleInvalidationForIdChange(oldId, newId, *this);
         }
     } else if (name == classAttr) {
+        // Identical class strings share their SpaceSplitString data, so this
+        // catches class attributes being reset to the value they already had.
+        const SpaceSplitString oldClasses = elementData()->classNames();
         classAttributeChanged(newValue);
+        shouldInvalidateNodeLists = elementData()->classNames() != oldClasses;
     } else if (name == HTMLNames::nameAttr) {
         setHasName(!newValue.isNull());
     }
 
-    invalidateNodeListCachesInAncestors(&name, this);
+    if (shouldInvalidateNodeLists)
+        invalidateNodeListCachesInAncestors(&name, this);
 
     // If there is currently no StyleResolver, we can't be sure that this attribute change won't affect style.
     if (!styleResolver)
@@ -1043,10 +1050,14 @@ void Element::classAttributeChanged(const AtomicString& newClassString)
         const SpaceSplitString& newClasses = elementData()->classNames();
         if (testShouldInvalidateStyle)
             styleResolver->ensureUpdatedRuleFeatureSet().scheduleStyleInvalidationForClassChange(oldClasses, newClasses, *this);
+        if (DocumentElementIndex* index = documentElementIndex())
+            index->classesChanged(*this, oldClasses, newClasses);
     } else {
         const SpaceSplitString& oldClasses = elementData()->classNames();
         if (testShouldInvalidateStyle)
             styleResolver->ensureUpdatedRuleFeatureSet().scheduleStyleInvalidationForClassChange(oldClasses, *this);
+        if (DocumentElementIndex* index = documentElementIndex())
+            index->classesChanged(*this, oldClasses, SpaceSplitString());
         elementData()->clearClass();
     }
 
@@ -1268,6 +1279,9 @@ Node::InsertionNotificationRequest Element::insertedInto(ContainerNode* insertio
     if (!nameValue.isNull())
         updateName(nullAtom, nameValue);
 
+    if (DocumentElementIndex* index = documentElementIndex())
+        index->addElement(*this);
+
     if (parentElement() && parentElement()->isInCanvasSubtree())
         setIsInCanvasSubtree(true);
 
@@ -1299,6 +1313,11 @@ void Element::removedFrom(ContainerNode* insertionPoint)
         const AtomicString& nameValue = getNameAttribute();
         if (!nameValue.isNull())
             updateName(nameValue, nullAtom);
+
+        if (wasInDocument) {
+            if (DocumentElementIndex* index = document().elementIndex())
+                index->removeElement(*this);
+        }
     }
 
     ContainerNode::removedFrom(insertionPoint);
@@ -2716,6 +2735,13 @@ bool Element::hasNamedNodeMap() const
 }
 #endif
 
+DocumentElementIndex* Element::documentElementIndex() const
+{
+    if (!inDocument() || treeScope() != document())
+        return 0;
+    return document().elementIndex();
+}
+
 inline void Element::updateName(const AtomicString& oldName, const AtomicString& newName)
 {
     if (!inDocument() || isInShadowTree())
@@ -2958,8 +2984,16 @@ void Element::cloneAttributesFromElement(const Element& other)
         detachAllAttrNodesFromElement();
 
     other.synchronizeAllAttributes();
+
+    // The class names are replaced without going through classAttributeChanged().
+    DocumentElementIndex* index = documentElementIndex();
+    if (index)
+        index->removeElement(*this);
+
     if (!other.m_elementData) {
         m_elementData.clear();
+        if (index)
+            index->addElement(*this);
         return;
     }
 
@@ -2997,6 +3031,9 @@ void Element::cloneAttributesFromElement(const Element& other)
     AttributeCollection::iterator end = attributes.end();
     for (AttributeCollection::iterator it = attributes.begin(); it != end; ++it)
         attributeChangedFromParserOrByCloning(it->name(), it->value(), ModifiedByCloning);
+
+    if (index)
+        index->addElement(*this);
 }
 
 void Element::cloneDataFromElement(const Element& other)
@@ -49,6 +49,7 @@ class CustomElementDefinition;
 class DOMStringMap;
 class DOMTokenList;
 class Document;
+class DocumentElementIndex;
 class ElementRareData;
 class ElementShadow;
 class ExceptionState;
@@ -579,6 +580,9 @@ private:
     void updateId(TreeScope&, const AtomicString& oldId, const AtomicString& newId);
     void updateName(const AtomicString& oldName, const AtomicString& newName);
 
+    // Returns the document's element index if it exists and covers this element.
+    DocumentElementIndex* documentElementIndex() const;
+
     virtual NodeType nodeType() const OVERRIDE FINAL;
     virtual bool childTypeAllowed(NodeType) const OVERRIDE FINAL;
 
@@ -98,6 +98,112 @@ private:
     RawPtrWillBeMember<Element> m_currentElement;
 };
 
+bool CompiledSelector::canCompile(const CSSSelector& firstSelector)
+{
+    for (const CSSSelector* selector = &firstSelector; selector; selector = selector->tagHistory()) {
+        switch (selector->match()) {
+        case CSSSelector::Tag:
+        case CSSSelector::Id:
+        case CSSSelector::Class:
+            break;
+        default:
+            return false;
+        }
+        if (selector->isLastInTagHistory())
+            break;
+        if (selector->relationIsAffectedByPseudoContent())
+            return false;
+        switch (selector->relation()) {
+        case CSSSelector::SubSelector:
+        case CSSSelector::Descendant:
+        case CSSSelector::Child:
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+void CompiledSelector::compile(const CSSSelector& firstSelector)
+{
+    ASSERT(canCompile(firstSelector));
+    ASSERT(!isCompiled());
+
+    unsigned compoundBegin = 0;
+    for (const CSSSelector* selector = &firstSelector; selector; selector = selector->tagHistory()) {
+        m_simpleSelectors.append(selector);
+        if (!selector->isLastInTagHistory() && selector->relation() == CSSSelector::SubSelector)
+            continue;
+        Compound compound;
+        compound.begin = compoundBegin;
+        compound.end = m_simpleSelectors.size();
+        compound.relation = selector->relation();
+        m_compounds.append(compound);
+        compoundBegin = compound.end;
+    }
+}
+
+inline bool CompiledSelector::compoundMatches(const Compound& compound, const Element& element) const
+{
+    // Mirrors the Tag, Class and Id cases of SelectorChecker::checkOne().
+    for (unsigned i = compound.begin; i < compound.end; ++i) {
+        const CSSSelector& selector = *m_simpleSelectors[i];
+        switch (selector.match()) {
+        case CSSSelector::Tag:
+            if (!SelectorChecker::tagMatches(element, selector.tagQName()))
+                return false;
+            break;
+        case CSSSelector::Class:
+            if (!element.hasClass() || !element.classNames().contains(selector.value()))
+                return false;
+            break;
+        case CSSSelector::Id:
+            if (!element.hasID() || element.idForStyleResolution() != selector.value())
+                return false;
+            break;
+        default:
+            ASSERT_NOT_REACHED();
+            return false;
+        }
+    }
+    return true;
+}
+
+// Same failure propagation as SelectorChecker::match(): once an ancestor walk
+// runs out of ancestors, no other ancestor of the starting element can match
+// either.
+CompiledSelector::MatchResult CompiledSelector::matchFrom(unsigned compoundIndex, Element& element) const
+{
+    const Compound& compound = m_compounds[compoundIndex];
+    if (!compoundMatches(compound, element))
+        return FailsLocally;
+
+    if (compoundIndex + 1 == m_compounds.size())
+        return Matches;
+
+    if (compound.relation == CSSSelector::Child) {
+        Element* parent = element.parentElement();
+        if (!parent)
+            return FailsCompletely;
+        return matchFrom(compoundIndex + 1, *parent);
+    }
+
+    ASSERT(compound.relation == CSSSelector::Descendant);
+    for (Element* ancestor = element.parentElement(); ancestor; ancestor = ancestor->parentElement()) {
+        MatchResult result = matchFrom(compoundIndex + 1, *ancestor);
+        if (result == Matches || result == FailsCompletely)
+            return result;
+    }
+    return FailsCompletely;
+}
+
+bool CompiledSelector::matches(Element& element) const
+{
+    ASSERT(isCompiled());
+    return matchFrom(0, element) == Matches;
+}
+
 void SelectorDataList::initialize(const CSSSelectorList& selectorList)
 {
     ASSERT(m_selectors.isEmpty());
@@ -113,10 +219,28 @@ void SelectorDataList::initialize(const CSSSelectorList& selectorList)
         m_selectors.uncheckedAppend(selector);
         m_crossesTreeBoundary |= selectorList.selectorCrossesTreeScopes(index);
     }
+
+    m_compiledSelectors.resize(selectorCount);
+    for (unsigned i = 0; i < selectorCount; ++i) {
+        if (CompiledSelector::canCompile(*m_selectors[i]))
+            m_compiledSelectors[i].compile(*m_selectors[i]);
+    }
+}
+
+inline bool SelectorDataList::canUseCompiledSelector(const ContainerNode& rootNode) const
+{
+    // Compiled selectors don't know about shadow tree scoping, which only
+    // matters when the query starts from inside a shadow tree.
+    return !m_crossesTreeBoundary && !rootNode.isInShadowTree();
 }
 
-inline bool SelectorDataList::selectorMatches(const CSSSelector& selector, Element& element, const ContainerNode& rootNode) const
+inline bool SelectorDataList::selectorMatches(unsigned selectorIndex, Element& element, const ContainerNode& rootNode) const
 {
+    const CompiledSelector& compiledSelector = m_compiledSelectors[selectorIndex];
+    if (compiledSelector.isCompiled() && canUseCompiledSelector(rootNode))
+        return compiledSelector.matches(element);
+
+    const CSSSelector& selector = *m_selectors[selectorIndex];
     SelectorChecker selectorChecker(element.document(), SelectorChecker::QueryingRules);
     SelectorChecker::SelectorCheckingContext selectorCheckingContext(selector, &element, SelectorChecker::VisitedMatchDisabled);
     selectorCheckingContext.scope = !rootNode.isDocumentNode() ? &rootNode : 0;
@@ -129,7 +253,7 @@ bool SelectorDataList::matches(Element& targetElement) const
 {
     unsigned selectorCount = m_selectors.size();
     for (unsigned i = 0; i < selectorCount; ++i) {
-        if (selectorMatches(*m_selectors[i], targetElement, targetElement))
+        if (selectorMatches(i, targetElement, targetElement))
             return true;
     }
 
@@ -218,14 +342,14 @@ void SelectorDataList::findTraverseRootsAndExecute(ContainerNode& rootNode, type
             else if (!element || isRightmostSelector)
                 adjustedNode = 0;
             if (isRightmostSelector) {
-                executeForTraverseRoot<SelectorQueryTrait>(*m_selectors[0], adjustedNode, MatchesTraverseRoots, rootNode, output);
+                executeForTraverseRoot<SelectorQueryTrait>(0, adjustedNode, MatchesTraverseRoots, rootNode, output);
                 return;
             }
 
             if (startFromParent && adjustedNode)
                 adjustedNode = adjustedNode->parentNode();
 
-            executeForTraverseRoot<SelectorQueryTrait>(*m_selectors[0], adjustedNode, DoesNotMatchTraverseRoots, rootNode, output);
+            executeForTraverseRoot<SelectorQueryTrait>(0, adjustedNode, DoesNotMatchTraverseRoots, rootNode, output);
             return;
         }
 
@@ -234,17 +358,17 @@ void SelectorDataList::findTraverseRootsAndExecute(ContainerNode& rootNode, type
         if (!SelectorQueryTrait::shouldOnlyMatchFirstElement && !startFromParent && selector->match() == CSSSelector::Class) {
             if (isRightmostSelector) {
                 ClassElementList<AllElements> traverseRoots(rootNode, selector->value());
-                executeForTraverseRoots<SelectorQueryTrait>(*m_selectors[0], traverseRoots, MatchesTraverseRoots, rootNode, output);
+                executeForTraverseRoots<SelectorQueryTrait>(0, traverseRoots, MatchesTraverseRoots, rootNode, output);
                 return;
             }
             // Since there exists some ancestor element which has the class name, we need to see all children of rootNode.
             if (ancestorHasClassName(rootNode, selector->value())) {
-                executeForTraverseRoot<SelectorQueryTrait>(*m_selectors[0], &rootNode, DoesNotMatchTraverseRoots, rootNode, output);
+                executeForTraverseRoot<SelectorQueryTrait>(0, &rootNode, DoesNotMatchTraverseRoots, rootNode, output);
                 return;
             }
 
             ClassElementList<OnlyRoots> traverseRoots(rootNode, selector->value());
-            executeForTraverseRoots<SelectorQueryTrait>(*m_selectors[0], traverseRoots, DoesNotMatchTraverseRoots, rootNode, output);
+            executeForTraverseRoots<SelectorQueryTrait>(0, traverseRoots, DoesNotMatchTraverseRoots, rootNode, output);
             return;
         }
 
@@ -257,23 +381,23 @@ void SelectorDataList::findTraverseRootsAndExecute(ContainerNode& rootNode, type
             startFromParent = false;
     }
 
-    executeForTraverseRoot<SelectorQueryTrait>(*m_selectors[0], &rootNode, DoesNotMatchTraverseRoots, rootNode, output);
+    executeForTraverseRoot<SelectorQueryTrait>(0, &rootNode, DoesNotMatchTraverseRoots, rootNode, output);
 }
 
 template <typename SelectorQueryTrait>
-void SelectorDataList::executeForTraverseRoot(const CSSSelector& selector, ContainerNode* traverseRoot, MatchTraverseRootState matchTraverseRoot, ContainerNode& rootNode, typename SelectorQueryTrait::OutputType& output) const
+void SelectorDataList::executeForTraverseRoot(unsigned selectorIndex, ContainerNode* traverseRoot, MatchTraverseRootState matchTraverseRoot, ContainerNode& rootNode, typename SelectorQueryTrait::OutputType& output) const
 {
     if (!traverseRoot)
         return;
 
     if (matchTraverseRoot) {
-        if (selectorMatches(selector, toElement(*traverseRoot), rootNode))
+        if (selectorMatches(selectorIndex, toElement(*traverseRoot), rootNode))
             SelectorQueryTrait::appendElement(output, toElement(*traverseRoot));
         return;
     }
 
     for (Element* element = ElementTraversal::firstWithin(*traverseRoot); element; element = ElementTraversal::next(*element, traverseRoot)) {
-        if (selectorMatches(selector, *element, rootNode)) {
+        if (selectorMatches(selectorIndex, *element, rootNode)) {
             SelectorQueryTrait::appendElement(output, *element);
             if (SelectorQueryTrait::shouldOnlyMatchFirstElement)
                 return;
@@ -282,7 +406,7 @@ void SelectorDataList::executeForTraverseRoot(const CSSSelector& selector, Conta
 }
 
 template <typename SelectorQueryTrait, typename SimpleElementListType>
-void SelectorDataList::executeForTraverseRoots(const CSSSelector& selector, SimpleElementListType& traverseRoots, MatchTraverseRootState matchTraverseRoots, ContainerNode& rootNode, typename SelectorQueryTrait::OutputType& output) const
+void SelectorDataList::executeForTraverseRoots(unsigned selectorIndex, SimpleElementListType& traverseRoots, MatchTraverseRootState matchTraverseRoots, ContainerNode& rootNode, typename SelectorQueryTrait::OutputType& output) const
 {
     if (traverseRoots.isEmpty())
         return;
@@ -290,7 +414,7 @@ void SelectorDataList::executeForTraverseRoots(const CSSSelector& selector, Simp
     if (matchTraverseRoots) {
         while (!traverseRoots.isEmpty()) {
             Element& element = *traverseRoots.next();
-            if (selectorMatches(selector, element, rootNode)) {
+            if (selectorMatches(selectorIndex, element, rootNode)) {
                 SelectorQueryTrait::appendElement(output, element);
                 if (SelectorQueryTrait::shouldOnlyMatchFirstElement)
                     return;
@@ -302,7 +426,7 @@ void SelectorDataList::executeForTraverseRoots(const CSSSelector& selector, Simp
     while (!traverseRoots.isEmpty()) {
         Element& traverseRoot = *traverseRoots.next();
         for (Element* element = ElementTraversal::firstWithin(traverseRoot); element; element = ElementTraversal::next(*element, &traverseRoot)) {
-            if (selectorMatches(selector, *element, rootNode)) {
+            if (selectorMatches(selectorIndex, *element, rootNode)) {
                 SelectorQueryTrait::appendElement(output, *element);
                 if (SelectorQueryTrait::shouldOnlyMatchFirstElement)
                     return;
@@ -315,7 +439,7 @@ template <typename SelectorQueryTrait>
 bool SelectorDataList::selectorListMatches(ContainerNode& rootNode, Element& element, typename SelectorQueryTrait::OutputType& output) const
 {
     for (unsigned i = 0; i < m_selectors.size(); ++i) {
-        if (selectorMatches(*m_selectors[i], element, rootNode)) {
+        if (selectorMatches(i, element, rootNode)) {
             SelectorQueryTrait::appendElement(output, element);
             return true;
         }
@@ -420,8 +544,8 @@ void SelectorDataList::execute(ContainerNode& rootNode, typename SelectorQueryTr
 
     ASSERT(m_selectors.size() == 1);
 
-    const CSSSelector& selector = *m_selectors[0];
-    const CSSSelector& firstSelector = selector;
+    const CSSSelector& firstSelector = *m_selectors[0];
+    const unsigned selectorIndex = 0;
 
     // Fast path for querySelector*('#id'), querySelector*('tag#id').
     if (const CSSSelector* idSelector = selectorForIdLookup(firstSelector)) {
@@ -433,7 +557,7 @@ void SelectorDataList::execute(ContainerNode& rootNode, typename SelectorQueryTr
                 Element& element = *elements[i];
                 if (!(isTreeScopeRoot(rootNode) || element.isDescendantOf(&rootNode)))
                     continue;
-                if (selectorMatches(selector, element, rootNode)) {
+                if (selectorMatches(selectorIndex, element, rootNode)) {
                     SelectorQueryTrait::appendElement(output, element);
                     if (SelectorQueryTrait::shouldOnlyMatchFirstElement)
                         return;
@@ -444,7 +568,7 @@ void SelectorDataList::execute(ContainerNode& rootNode, typename SelectorQueryTr
         Element* element = rootNode.treeScope().getElementById(idToMatch);
         if (!element || !(isTreeScopeRoot(rootNode) || element->isDescendantOf(&rootNode)))
             return;
-        if (selectorMatches(selector, *element, rootNode))
+        if (selectorMatches(selectorIndex, *element, rootNode))
             SelectorQueryTrait::appendElement(output, *element);
         return;
     }
@@ -43,6 +43,37 @@ class ExceptionState;
 template <typename NodeType> class StaticNodeTypeList;
 typedef StaticNodeTypeList<Element> StaticElementList;
 
+// A selector made only of tag, id and class simple selectors joined by
+// descendant or child combinators. The compound selectors and combinators are
+// flattened once when the query is created, so that matching a candidate
+// element does not need to go through SelectorChecker.
+class CompiledSelector {
+public:
+    CompiledSelector() { }
+
+    static bool canCompile(const CSSSelector&);
+    void compile(const CSSSelector&);
+
+    bool isCompiled() const { return !m_compounds.isEmpty(); }
+    bool matches(Element&) const;
+
+private:
+    enum MatchResult { Matches, FailsLocally, FailsCompletely };
+
+    struct Compound {
+        unsigned begin;
+        unsigned end;
+        // The combinator between this compound and the next one to the left.
+        CSSSelector::Relation relation;
+    };
+
+    bool compoundMatches(const Compound&, const Element&) const;
+    MatchResult matchFrom(unsigned compoundIndex, Element&) const;
+
+    Vector<const CSSSelector*> m_simpleSelectors;
+    Vector<Compound> m_compounds;
+};
+
 class SelectorDataList {
 public:
     void initialize(const CSSSelectorList&);
@@ -52,7 +83,8 @@ public:
 
 private:
     bool canUseFastQuery(const ContainerNode& rootNode) const;
-    bool selectorMatches(const CSSSelector&, Element&, const ContainerNode&) const;
+    bool canUseCompiledSelector(const ContainerNode& rootNode) const;
+    bool selectorMatches(unsigned selectorIndex, Element&, const ContainerNode&) const;
 
     template <typename SelectorQueryTrait>
     void collectElementsByClassName(ContainerNode& rootNode, const AtomicString& className, typename SelectorQueryTrait::OutputType&) const;
@@ -64,9 +96,9 @@ private:
 
     enum MatchTraverseRootState { DoesNotMatchTraverseRoots, MatchesTraverseRoots };
     template <typename SelectorQueryTrait>
-    void executeForTraverseRoot(const CSSSelector&, ContainerNode* traverseRoot, MatchTraverseRootState, ContainerNode& rootNode, typename SelectorQueryTrait::OutputType&) const;
+    void executeForTraverseRoot(unsigned selectorIndex, ContainerNode* traverseRoot, MatchTraverseRootState, ContainerNode& rootNode, typename SelectorQueryTrait::OutputType&) const;
     template <typename SelectorQueryTrait, typename SimpleElementListType>
-    void executeForTraverseRoots(const CSSSelector&, SimpleElementListType& traverseRoots, MatchTraverseRootState, ContainerNode& rootNode, typename SelectorQueryTrait::OutputType&) const;
+    void executeForTraverseRoots(unsigned selectorIndex, SimpleElementListType& traverseRoots, MatchTraverseRootState, ContainerNode& rootNode, typename SelectorQueryTrait::OutputType&) const;
 
     template <typename SelectorQueryTrait>
     bool selectorListMatches(ContainerNode& rootNode, Element&, typename SelectorQueryTrait::OutputType&) const;
@@ -79,6 +111,7 @@ private:
     const CSSSelector* selectorForIdLookup(const CSSSelector&) const;
 
     Vector<const CSSSelector*> m_selectors;
+    Vector<CompiledSelector> m_compiledSelectors;
     bool m_crossesTreeBoundary;
 };
 
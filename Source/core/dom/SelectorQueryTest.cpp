@@ -0,0 +1,83 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/dom/SelectorQuery.h"
+
+#include "core/css/parser/CSSParser.h"
+#include "core/dom/Document.h"
+#include "core/dom/StaticNodeList.h"
+#include "core/testing/DummyPageHolder.h"
+#include <gtest/gtest.h>
+
+namespace blink {
+
+class SelectorQueryTest : public ::testing::Test {
+protected:
+    virtual void SetUp() OVERRIDE
+    {
+        m_dummyPageHolder = DummyPageHolder::create(IntSize(800, 600));
+        document().documentElement()->setInnerHTML(String("<body>"
+            "<div id='outer' class='a'>"
+            "  <section class='b'><span id='s1' class='c'></span></section>"
+            "  <span id='s2' class='c'></span>"
+            "</div>"
+            "<div class='b'><p><span id='s3' class='c d'></span></p></div>"
+            "</body>"), ASSERT_NO_EXCEPTION);
+    }
+
+    Document& document() const { return m_dummyPageHolder->document(); }
+
+    static bool canCompile(const char* selectorText)
+    {
+        CSSParser parser(CSSParserContext(HTMLStandardMode, 0));
+        CSSSelectorList selectorList;
+        parser.parseSelector(selectorText, selectorList);
+        return selectorList.first() && CompiledSelector::canCompile(*selectorList.first());
+    }
+
+    unsigned countMatches(ContainerNode& root, const char* selectorText)
+    {
+        return root.querySelectorAll(AtomicString(selectorText), ASSERT_NO_EXCEPTION)->length();
+    }
+
+private:
+    OwnPtr<DummyPageHolder> m_dummyPageHolder;
+};
+
+TEST_F(SelectorQueryTest, CanCompile)
+{
+    EXPECT_TRUE(canCompile("div"));
+    EXPECT_TRUE(canCompile("div.a > span#s1"));
+    EXPECT_TRUE(canCompile(".a .b .c"));
+    EXPECT_FALSE(canCompile("div + span"));
+    EXPECT_FALSE(canCompile("div ~ span"));
+    EXPECT_FALSE(canCompile("[id]"));
+    EXPECT_FALSE(canCompile("span:first-child"));
+}
+
+TEST_F(SelectorQueryTest, CompiledDescendantAndChild)
+{
+    EXPECT_EQ(3u, countMatches(document(), "div span"));
+    EXPECT_EQ(1u, countMatches(document(), "div > span"));
+    EXPECT_EQ(2u, countMatches(document(), ".a .c"));
+    EXPECT_EQ(2u, countMatches(document(), ".b span.c"));
+    EXPECT_EQ(1u, countMatches(document(), "div.b > p > span.c.d"));
+    EXPECT_EQ(1u, countMatches(document(), "#outer > section > #s1"));
+    EXPECT_EQ(0u, countMatches(document(), "section > div span"));
+}
+
+TEST_F(SelectorQueryTest, CompiledScopedQuery)
+{
+    Element* outer = document().getElementById("outer");
+    ASSERT_TRUE(outer);
+    EXPECT_EQ(2u, countMatches(*outer, "span"));
+    // Ancestors outside of the scoping element still take part in matching.
+    EXPECT_EQ(2u, countMatches(*outer, "body div span"));
+    EXPECT_EQ(1u, countMatches(*outer, "div > section span"));
+    EXPECT_TRUE(document().getElementById("s1")->matches("#outer span", ASSERT_NO_EXCEPTION));
+    EXPECT_FALSE(document().getElementById("s3")->matches("#outer span", ASSERT_NO_EXCEPTION));
+}
+
+} // namespace blink
@@ -0,0 +1,125 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/dom/SharedInlineStyleSheetCache.h"
+
+#include "core/css/StyleSheetContents.h"
+#include "core/css/parser/CSSParserMode.h"
+#include "wtf/Vector.h"
+
+namespace blink {
+
+static const size_t maximumSharedInlineStyleSheets = 64;
+static const size_t maximumSharedInlineStyleSheetBytes = 1024 * 1024;
+
+static size_t estimatedEntrySizeInBytes(const AtomicString& text, const StyleSheetContents& contents)
+{
+    size_t textSizeInBytes = text.length() * (text.is8Bit() ? sizeof(LChar) : sizeof(UChar));
+    return textSizeInBytes + contents.estimatedSizeInBytes();
+}
+
+SharedInlineStyleSheetCache& SharedInlineStyleSheetCache::instance()
+{
+    DEFINE_STATIC_LOCAL(SharedInlineStyleSheetCache, cache, ());
+    return cache;
+}
+
+SharedInlineStyleSheetCache::SharedInlineStyleSheetCache()
+    : m_sizeInBytes(0)
+{
+}
+
+bool SharedInlineStyleSheetCache::isShareable(const StyleSheetContents& contents)
+{
+    // FIXME: Support copying import rules.
+    if (!contents.importRules().isEmpty())
+        return false;
+    if (contents.isMutable())
+        return false;
+    if (!contents.hasSyntacticallyValidCSSHeader())
+        return false;
+    return !contents.hasMediaQueries();
+}
+
+StyleSheetContents* SharedInlineStyleSheetCache::find(const AtomicString& text, const CSSParserContext& context, AddRuleFlags ruleFlags)
+{
+    SheetMap::iterator it = m_sheets.find(text);
+    if (it == m_sheets.end())
+        return 0;
+    StyleSheetContents* contents = it->value.get();
+    if (!isShareable(*contents)) {
+        // Mutated in place by a client that had already lost its owner document.
+        removeEntry(text);
+        return 0;
+    }
+    if (contents->parserContext() != context || m_entryInfos.get(text).ruleFlags != ruleFlags)
+        return 0;
+    m_useOrder.appendOrMoveToLast(text);
+    return contents;
+}
+
+void SharedInlineStyleSheetCache::add(const AtomicString& text, StyleSheetContents* contents, AddRuleFlags ruleFlags)
+{
+    ASSERT(isShareable(*contents));
+    removeEntriesWithoutClients();
+    // If the same text was last parsed in a different context, keep the newer sheet.
+    removeEntry(text);
+
+    size_t entrySizeInBytes = estimatedEntrySizeInBytes(text, *contents);
+    if (entrySizeInBytes > maximumSharedInlineStyleSheetBytes)
+        return;
+    while (!m_useOrder.isEmpty() && (m_sheets.size() >= maximumSharedInlineStyleSheets || m_sizeInBytes + entrySizeInBytes > maximumSharedInlineStyleSheetBytes))
+        removeEntry(m_useOrder.first());
+
+    m_sheets.set(text, contents);
+    m_entryInfos.set(text, EntryInfo(entrySizeInBytes, ruleFlags));
+    m_useOrder.appendOrMoveToLast(text);
+    m_sizeInBytes += entrySizeInBytes;
+}
+
+void SharedInlineStyleSheetCache::remove(StyleSheetContents* contents)
+{
+    for (SheetMap::iterator it = m_sheets.begin(); it != m_sheets.end(); ++it) {
+        if (it->value == contents) {
+            removeEntry(it->key);
+            return;
+        }
+    }
+}
+
+void SharedInlineStyleSheetCache::clear()
+{
+    m_sheets.clear();
+    m_entryInfos.clear();
+    m_useOrder.clear();
+    m_sizeInBytes = 0;
+}
+
+void SharedInlineStyleSheetCache::removeEntry(const AtomicString& text)
+{
+    // Keep the text alive, it might be owned by the entry that is removed.
+    AtomicString key = text;
+    HashMap<AtomicString, EntryInfo>::iterator it = m_entryInfos.find(key);
+    if (it == m_entryInfos.end())
+        return;
+    ASSERT(m_sizeInBytes >= it->value.sizeInBytes);
+    m_sizeInBytes -= it->value.sizeInBytes;
+    m_entryInfos.remove(it);
+    m_sheets.remove(key);
+    m_useOrder.remove(key);
+}
+
+void SharedInlineStyleSheetCache::removeEntriesWithoutClients()
+{
+    Vector<AtomicString> unusedTexts;
+    for (SheetMap::iterator it = m_sheets.begin(); it != m_sheets.end(); ++it) {
+        if (!it->value->clientSize())
+            unusedTexts.append(it->key);
+    }
+    for (size_t i = 0; i < unusedTexts.size(); ++i)
+        removeEntry(unusedTexts[i]);
+}
+
+} // namespace blink
@@ -0,0 +1,83 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SharedInlineStyleSheetCache_h
+#define SharedInlineStyleSheetCache_h
+
+#include "core/css/RuleSet.h"
+#include "platform/heap/Handle.h"
+#include "wtf/HashMap.h"
+#include "wtf/ListHashSet.h"
+#include "wtf/Noncopyable.h"
+#include "wtf/text/AtomicString.h"
+#include "wtf/text/AtomicStringHash.h"
+
+namespace blink {
+
+class CSSParserContext;
+class StyleSheetContents;
+
+// Inline sheets whose text, parser context and rule flags match are shared between
+// documents, e.g. same-origin frames that inline the same <style> block, together with
+// the RuleSet built from them. Only sheets without media queries are shared, as their
+// RuleSet would depend on the document they are evaluated in.
+//
+// The cache is bounded both in entries and in estimated bytes and evicts the least
+// recently used sheets first. A sheet is dropped as soon as StyleEngine learns it may
+// not be shared anymore, i.e. when its last client goes away or it is mutated in place
+// through the CSSOM, and sheets that lost their clients without StyleEngine noticing
+// are dropped on the next add().
+class SharedInlineStyleSheetCache {
+    WTF_MAKE_NONCOPYABLE(SharedInlineStyleSheetCache); WTF_MAKE_FAST_ALLOCATED;
+public:
+    static SharedInlineStyleSheetCache& instance();
+
+    static bool isShareable(const StyleSheetContents&);
+
+    // Returns a sheet parsed from the text in an equal context whose RuleSet is built
+    // with the given flags, or 0.
+    StyleSheetContents* find(const AtomicString& text, const CSSParserContext&, AddRuleFlags);
+    void add(const AtomicString& text, StyleSheetContents*, AddRuleFlags);
+    void remove(StyleSheetContents*);
+
+    // Called when the embedder asks to free memory.
+    void clear();
+
+    size_t size() const { return m_sheets.size(); }
+    size_t sizeInBytes() const { return m_sizeInBytes; }
+
+private:
+    SharedInlineStyleSheetCache();
+
+    struct EntryInfo {
+        EntryInfo()
+            : sizeInBytes(0)
+            , ruleFlags(RuleHasNoSpecialState)
+        {
+        }
+
+        EntryInfo(size_t entrySizeInBytes, AddRuleFlags entryRuleFlags)
+            : sizeInBytes(entrySizeInBytes)
+            , ruleFlags(entryRuleFlags)
+        {
+        }
+
+        size_t sizeInBytes;
+        AddRuleFlags ruleFlags;
+    };
+
+    void removeEntry(const AtomicString& text);
+    void removeEntriesWithoutClients();
+
+    typedef WillBePersistentHeapHashMap<AtomicString, RefPtrWillBeMember<StyleSheetContents> > SheetMap;
+    SheetMap m_sheets;
+    HashMap<AtomicString, EntryInfo> m_entryInfos;
+    // Least recently used first.
+    ListHashSet<AtomicString> m_useOrder;
+    size_t m_sizeInBytes;
+};
+
+} // namespace blink
+
+#endif // SharedInlineStyleSheetCache_h
@@ -0,0 +1,195 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/dom/SharedInlineStyleSheetCache.h"
+
+#include "bindings/core/v8/ExceptionStatePlaceholder.h"
+#include "core/css/CSSStyleSheet.h"
+#include "core/css/StyleSheetContents.h"
+#include "core/dom/Document.h"
+#include "core/html/HTMLElement.h"
+#include "core/html/HTMLStyleElement.h"
+#include "core/testing/DummyPageHolder.h"
+#include "wtf/text/StringBuilder.h"
+#include <gtest/gtest.h>
+
+using namespace blink;
+
+namespace {
+
+class SharedInlineStyleSheetCacheTest : public ::testing::Test {
+protected:
+    virtual void SetUp() OVERRIDE
+    {
+        SharedInlineStyleSheetCache::instance().clear();
+        m_firstPageHolder = createPageHolder();
+        m_secondPageHolder = createPageHolder();
+    }
+
+    virtual void TearDown() OVERRIDE
+    {
+        SharedInlineStyleSheetCache::instance().clear();
+    }
+
+    Document& firstDocument() const { return m_firstPageHolder->document(); }
+    Document& secondDocument() const { return m_secondPageHolder->document(); }
+    SharedInlineStyleSheetCache& cache() const { return SharedInlineStyleSheetCache::instance(); }
+
+    // Replaces the body content with a <style> element and returns its sheet.
+    CSSStyleSheet* setStyleElement(Document& document, const String& text)
+    {
+        document.body()->setInnerHTML("<style>" + text + "</style>", ASSERT_NO_EXCEPTION);
+        HTMLStyleElement* style = toHTMLStyleElement(document.body()->firstChild());
+        return style->sheet();
+    }
+
+    // Appends a <style> element to the body and returns its sheet.
+    CSSStyleSheet* appendStyleElement(Document& document, const String& text)
+    {
+        RefPtrWillBeRawPtr<Element> style = document.createElement("style", ASSERT_NO_EXCEPTION);
+        style->setTextContent(text);
+        document.body()->appendChild(style, ASSERT_NO_EXCEPTION);
+        return toHTMLStyleElement(style.get())->sheet();
+    }
+
+private:
+    static PassOwnPtr<DummyPageHolder> createPageHolder()
+    {
+        OwnPtr<DummyPageHolder> pageHolder = DummyPageHolder::create(IntSize(800, 600));
+        // Inline sheets aren't cached in quirks mode.
+        pageHolder->document().setCompatibilityMode(Document::NoQuirksMode);
+        return pageHolder.release();
+    }
+
+    OwnPtr<DummyPageHolder> m_firstPageHolder;
+    OwnPtr<DummyPageHolder> m_secondPageHolder;
+};
+
+TEST_F(SharedInlineStyleSheetCacheTest, SameTextIsSharedAcrossDocuments)
+{
+    CSSStyleSheet* first = setStyleElement(firstDocument(), ".a { color: green }");
+    CSSStyleSheet* second = setStyleElement(secondDocument(), ".a { color: green }");
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(first->contents(), second->contents());
+    EXPECT_EQ(2u, first->contents()->clientSize());
+    EXPECT_EQ(1u, cache().size());
+
+    CSSStyleSheet* other = setStyleElement(secondDocument(), ".a { color: red }");
+    EXPECT_NE(first->contents(), other->contents());
+}
+
+TEST_F(SharedInlineStyleSheetCacheTest, SheetsWithMediaQueriesAreNotShared)
+{
+    CSSStyleSheet* first = setStyleElement(firstDocument(), "@media (min-width: 100px) { .a { color: green } }");
+    CSSStyleSheet* second = setStyleElement(secondDocument(), "@media (min-width: 100px) { .a { color: green } }");
+    EXPECT_NE(first->contents(), second->contents());
+    EXPECT_EQ(0u, cache().size());
+}
+
+TEST_F(SharedInlineStyleSheetCacheTest, MutatingSharedSheetCopiesOnWrite)
+{
+    CSSStyleSheet* first = setStyleElement(firstDocument(), ".a { color: green }");
+    CSSStyleSheet* second = setStyleElement(secondDocument(), ".a { color: green }");
+    RefPtrWillBeRawPtr<StyleSheetContents> sharedContents = first->contents();
+    ASSERT_EQ(sharedContents, second->contents());
+
+    first->insertRule(".b { color: red }", 0, ASSERT_NO_EXCEPTION);
+    EXPECT_NE(sharedContents, first->contents());
+    EXPECT_EQ(2u, first->contents()->ruleCount());
+    EXPECT_EQ(sharedContents, second->contents());
+    EXPECT_EQ(1u, sharedContents->ruleCount());
+    EXPECT_FALSE(sharedContents->isMutable());
+
+    // The unmodified sheet is still handed out.
+    CSSStyleSheet* third = setStyleElement(firstDocument(), ".a { color: green }");
+    EXPECT_EQ(sharedContents, third->contents());
+}
+
+TEST_F(SharedInlineStyleSheetCacheTest, MutatingOnlyClientRemovesSheet)
+{
+    CSSStyleSheet* first = setStyleElement(firstDocument(), ".a { color: green }");
+    RefPtrWillBeRawPtr<StyleSheetContents> contents = first->contents();
+    EXPECT_EQ(1u, cache().size());
+
+    first->insertRule(".b { color: red }", 0, ASSERT_NO_EXCEPTION);
+    EXPECT_EQ(contents, first->contents());
+    EXPECT_EQ(0u, cache().size());
+
+    CSSStyleSheet* second = setStyleElement(secondDocument(), ".a { color: green }");
+    EXPECT_NE(contents, second->contents());
+    EXPECT_EQ(1u, second->contents()->ruleCount());
+}
+
+TEST_F(SharedInlineStyleSheetCacheTest, LeastRecentlyUsedSheetIsEvicted)
+{
+    StringBuilder styles;
+    for (unsigned i = 0; i <= 64; ++i)
+        styles.append(String::format("<style>.a%u { color: green }</style>", i));
+    firstDocument().body()->setInnerHTML(styles.toString(), ASSERT_NO_EXCEPTION);
+    EXPECT_EQ(64u, cache().size());
+    EXPECT_GT(cache().sizeInBytes(), 0u);
+
+    CSSStyleSheet* first = setStyleElement(secondDocument(), ".a0 { color: green }");
+    EXPECT_EQ(1u, first->contents()->clientSize());
+}
+
+TEST_F(SharedInlineStyleSheetCacheTest, SheetsTooLargeToShareAreSharedWithinDocument)
+{
+    StringBuilder text;
+    text.append("/*");
+    for (unsigned i = 0; i < 1024 * 1024; ++i)
+        text.append('x');
+    text.append("*/ .a { color: green }");
+
+    CSSStyleSheet* first = appendStyleElement(firstDocument(), text.toString());
+    EXPECT_EQ(0u, cache().size());
+    for (unsigned i = 0; i < 3; ++i) {
+        CSSStyleSheet* sheet = appendStyleElement(firstDocument(), text.toString());
+        EXPECT_EQ(first->contents(), sheet->contents());
+    }
+    EXPECT_EQ(4u, first->contents()->clientSize());
+
+    CSSStyleSheet* other = appendStyleElement(secondDocument(), text.toString());
+    EXPECT_NE(first->contents(), other->contents());
+}
+
+TEST_F(SharedInlineStyleSheetCacheTest, EvictedSheetIsStillSharedWithinDocument)
+{
+    CSSStyleSheet* first = appendStyleElement(firstDocument(), ".a { color: green }");
+    for (unsigned i = 0; i < 64; ++i)
+        appendStyleElement(secondDocument(), String::format(".b%u { color: green }", i));
+    EXPECT_EQ(64u, cache().size());
+
+    CSSStyleSheet* second = appendStyleElement(firstDocument(), ".a { color: green }");
+    EXPECT_EQ(first->contents(), second->contents());
+}
+
+TEST_F(SharedInlineStyleSheetCacheTest, SheetSharedWithAnotherDocumentLeavesDocumentCache)
+{
+    CSSStyleSheet* first = appendStyleElement(firstDocument(), ".a { color: green }");
+    CSSStyleSheet* second = appendStyleElement(secondDocument(), ".a { color: green }");
+    ASSERT_EQ(first->contents(), second->contents());
+
+    // The first document would not be told when the last client of a sheet with
+    // clients in several documents goes away, so it must not keep the sheet.
+    cache().clear();
+    CSSStyleSheet* third = appendStyleElement(firstDocument(), ".a { color: green }");
+    EXPECT_NE(first->contents(), third->contents());
+}
+
+TEST_F(SharedInlineStyleSheetCacheTest, ClearDropsAllSheets)
+{
+    CSSStyleSheet* first = setStyleElement(firstDocument(), ".a { color: green }");
+    EXPECT_EQ(1u, cache().size());
+    cache().clear();
+    EXPECT_EQ(0u, cache().size());
+    EXPECT_EQ(0u, cache().sizeInBytes());
+
+    CSSStyleSheet* second = setStyleElement(secondDocument(), ".a { color: green }");
+    EXPECT_NE(first->contents(), second->contents());
+}
+
+} // namespace
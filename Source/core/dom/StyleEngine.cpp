@@ -37,6 +37,7 @@
 #include "core/dom/Element.h"
 #include "core/dom/ProcessingInstruction.h"
 #include "core/dom/ShadowTreeStyleSheetCollection.h"
+#include "core/dom/SharedInlineStyleSheetCache.h"
 #include "core/dom/shadow/ShadowRoot.h"
 #include "core/html/HTMLIFrameElement.h"
 #include "core/html/HTMLLinkElement.h"
@@ -46,6 +47,7 @@
 #include "core/page/Page.h"
 #include "core/frame/Settings.h"
 #include "platform/URLPatternMatcher.h"
+#include "platform/weborigin/SecurityOrigin.h"
 
 namespace blink {
 
@@ -642,10 +644,29 @@ PassRefPtrWillBeRawPtr<CSSStyleSheet> StyleEngine::createSheet(Element* e, const
 
         WillBeHeapHashMap<AtomicString, RawPtrWillBeMember<StyleSheetContents> >::AddResult result = m_textToSheetCache.add(textContent, nullptr);
         if (result.isNewEntry || !result.storedValue->value) {
-            styleSheet = StyleEngine::parseSheet(e, text, startPosition, createdByParser);
-            if (result.isNewEntry && isCacheableForStyleElement(*styleSheet->contents())) {
-                result.storedValue->value = styleSheet->contents();
-                m_sheetToTextCache.add(styleSheet->contents(), textContent);
+            CSSParserContext context(e->document(), 0, KURL(), e->document().inputEncoding());
+            AddRuleFlags ruleFlags = e->document().securityOrigin()->canRequest(context.baseURL()) ? RuleHasDocumentSecurityOrigin : RuleHasNoSpecialState;
+            SharedInlineStyleSheetCache& sharedSheets = SharedInlineStyleSheetCache::instance();
+            StyleSheetContents* contents = sharedSheets.find(textContent, context, ruleFlags);
+            if (contents) {
+                // The per-document caches only hold sheets whose clients are all in that
+                // document, so a sheet handed to another document leaves the cache of the
+                // one that owned it so far.
+                Document* ownerDocument = contents->singleOwnerDocument();
+                if (ownerDocument && ownerDocument != &e->document())
+                    ownerDocument->styleEngine()->removeSheetFromTextCache(contents);
+                styleSheet = CSSStyleSheet::createInline(contents, e, startPosition);
+            } else {
+                styleSheet = StyleEngine::parseSheet(e, text, startPosition, createdByParser);
+                contents = styleSheet->contents();
+                // The shared cache may reject or later evict the sheet, so it is cached
+                // for this document as well.
+                if (SharedInlineStyleSheetCache::isShareable(*contents))
+                    sharedSheets.add(textContent, contents, ruleFlags);
+            }
+            if (result.isNewEntry && contents->singleOwnerDocument() == e->document() && isCacheableForStyleElement(*contents)) {
+                result.storedValue->value = contents;
+                m_sheetToTextCache.add(contents, textContent);
             }
         } else {
             StyleSheetContents* contents = result.storedValue->value;
@@ -673,6 +694,12 @@ PassRefPtrWillBeRawPtr<CSSStyleSheet> StyleEngine::parseSheet(Element* e, const
 }
 
 void StyleEngine::removeSheet(StyleSheetContents* contents)
+{
+    SharedInlineStyleSheetCache::instance().remove(contents);
+    removeSheetFromTextCache(contents);
+}
+
+void StyleEngine::removeSheetFromTextCache(StyleSheetContents* contents)
 {
     WillBeHeapHashMap<RawPtrWillBeMember<StyleSheetContents>, AtomicString>::iterator it = m_sheetToTextCache.find(contents);
     if (it == m_sheetToTextCache.end())
@@ -203,6 +203,7 @@ private:
     void createResolver();
 
     static PassRefPtrWillBeRawPtr<CSSStyleSheet> parseSheet(Element*, const String& text, TextPosition startPosition, bool createdByParser);
+    void removeSheetFromTextCache(StyleSheetContents*);
 
     const DocumentStyleSheetCollection* documentStyleSheetCollection() const
     {
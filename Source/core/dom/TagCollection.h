@@ -48,6 +48,9 @@ public:
 
     bool elementMatches(const Element&) const;
 
+    const AtomicString& namespaceURI() const { return m_namespaceURI; }
+    const AtomicString& localName() const { return m_localName; }
+
 protected:
     TagCollection(ContainerNode& rootNode, CollectionType, const AtomicString& namespaceURI, const AtomicString& localName);
 
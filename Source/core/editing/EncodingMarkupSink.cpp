@@ -0,0 +1,62 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/editing/EncodingMarkupSink.h"
+
+#include "wtf/ASCIICType.h"
+#include "wtf/text/CString.h"
+
+namespace blink {
+
+static bool isStatefulEncoding(const WTF::TextEncoding& encoding)
+{
+    String name(encoding.name());
+    return name.startsWith("ISO-2022", false) || name.startsWith("HZ", false) || equalIgnoringCase(name, "UTF-7");
+}
+
+EncodingMarkupSink::EncodingMarkupSink(const WTF::TextEncoding& encoding)
+    : m_encoding(encoding)
+    , m_isStateful(isStatefulEncoding(encoding))
+    , m_buffer(SharedBuffer::create())
+{
+}
+
+void EncodingMarkupSink::appendMarkupChunk(const String& chunk)
+{
+    m_pendingMarkup.append(chunk);
+    if (m_isStateful)
+        return;
+
+    size_t splitOffset = m_pendingMarkup.length();
+    while (splitOffset && !isASCII(m_pendingMarkup[splitOffset - 1]))
+        --splitOffset;
+    // Keep the last ASCII character, and whatever follows it, pending: a
+    // combining character in the next chunk may still compose with it.
+    if (splitOffset < 2)
+        return;
+    --splitOffset;
+
+    String pendingMarkup = m_pendingMarkup.toString();
+    m_pendingMarkup.clear();
+    encodeAndAppend(pendingMarkup.left(splitOffset));
+    m_pendingMarkup.append(pendingMarkup, splitOffset, pendingMarkup.length() - splitOffset);
+}
+
+PassRefPtr<SharedBuffer> EncodingMarkupSink::finish()
+{
+    if (!m_pendingMarkup.isEmpty()) {
+        encodeAndAppend(m_pendingMarkup.toString());
+        m_pendingMarkup.clear();
+    }
+    return m_buffer;
+}
+
+void EncodingMarkupSink::encodeAndAppend(const String& markup)
+{
+    CString encodedMarkup = m_encoding.normalizeAndEncode(markup, WTF::EntitiesForUnencodables);
+    m_buffer->append(encodedMarkup.data(), encodedMarkup.length());
+}
+
+} // namespace blink
@@ -0,0 +1,44 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EncodingMarkupSink_h
+#define EncodingMarkupSink_h
+
+#include "core/editing/MarkupAccumulator.h"
+#include "platform/SharedBuffer.h"
+#include "wtf/RefPtr.h"
+#include "wtf/text/StringBuilder.h"
+#include "wtf/text/TextEncoding.h"
+
+namespace blink {
+
+// Normalizes markup to NFC and encodes it as it is streamed, producing the
+// same bytes as TextEncoding::normalizeAndEncode() on the whole markup.
+//
+// Chunks are only encoded up to their last ASCII character: normalization
+// never combines an ASCII character with what precedes it, and every encoder
+// is back in its initial state before one. Encodings that switch state with
+// escape sequences (ISO-2022, HZ, UTF-7) are encoded in one go by finish().
+class EncodingMarkupSink FINAL : public MarkupSink {
+    WTF_MAKE_NONCOPYABLE(EncodingMarkupSink);
+public:
+    explicit EncodingMarkupSink(const WTF::TextEncoding&);
+
+    virtual void appendMarkupChunk(const String&) OVERRIDE;
+
+    // Encodes whatever markup is still pending and returns the encoded bytes.
+    PassRefPtr<SharedBuffer> finish();
+
+private:
+    void encodeAndAppend(const String&);
+
+    const WTF::TextEncoding& m_encoding;
+    const bool m_isStateful;
+    StringBuilder m_pendingMarkup;
+    RefPtr<SharedBuffer> m_buffer;
+};
+
+} // namespace blink
+
+#endif // EncodingMarkupSink_h
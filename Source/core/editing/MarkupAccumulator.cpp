@@ -97,9 +97,14 @@ void MarkupAccumulator::appendCharactersReplacingEntities(StringBuilder& result,
         appendCharactersReplacingEntitiesInternal(result, source.characters16() + offset, length, entityMaps, WTF_ARRAY_LENGTH(entityMaps), entityMask);
 }
 
+// Markup is handed to a MarkupSink once this much has been accumulated.
+static const size_t markupSinkChunkLength = 64 * 1024;
+
 MarkupAccumulator::MarkupAccumulator(WillBeHeapVector<RawPtrWillBeMember<Node> >* nodes, EAbsoluteURLs resolveUrlsMethod, const Range* range, SerializationType serializationType)
     : m_nodes(nodes)
     , m_range(range)
+    , m_sink(0)
+    , m_sinkChunkLength(markupSinkChunkLength)
     , m_resolveURLsMethod(resolveUrlsMethod)
     , m_serializationType(serializationType)
 {
@@ -110,6 +115,22 @@ MarkupAccumulator::~MarkupAccumulator()
 }
 
 String MarkupAccumulator::serializeNodes(Node& targetNode, EChildrenOnly childrenOnly, Vector<QualifiedName>* tagNamesToSkip)
+{
+    serializeNodesInternal(targetNode, childrenOnly, tagNamesToSkip);
+    return m_markup.toString();
+}
+
+void MarkupAccumulator::serializeNodes(Node& targetNode, EChildrenOnly childrenOnly, MarkupSink& sink, Vector<QualifiedName>* tagNamesToSkip)
+{
+    ASSERT(!m_sink);
+    ASSERT(m_markup.isEmpty());
+    m_sink = &sink;
+    serializeNodesInternal(targetNode, childrenOnly, tagNamesToSkip);
+    flushMarkupToSink(0);
+    m_sink = 0;
+}
+
+void MarkupAccumulator::serializeNodesInternal(Node& targetNode, EChildrenOnly childrenOnly, Vector<QualifiedName>* tagNamesToSkip)
 {
     Namespaces* namespaces = 0;
     Namespaces namespaceHash;
@@ -120,7 +141,14 @@ String MarkupAccumulator::serializeNodes(Node& targetNode, EChildrenOnly childre
     }
 
     serializeNodesWithNamespaces(targetNode, childrenOnly, namespaces, tagNamesToSkip);
-    return m_markup.toString();
+}
+
+void MarkupAccumulator::flushMarkupToSink(size_t minimumLength)
+{
+    if (!m_sink || m_markup.isEmpty() || m_markup.length() < minimumLength)
+        return;
+    m_sink->appendMarkupChunk(m_markup.toString());
+    m_markup.clear();
 }
 
 void MarkupAccumulator::serializeNodesWithNamespaces(Node& targetNode, EChildrenOnly childrenOnly, const Namespaces* namespaces, Vector<QualifiedName>* tagNamesToSkip)
@@ -145,8 +173,10 @@ void MarkupAccumulator::serializeNodesWithNamespaces(Node& targetNode, EChildren
             serializeNodesWithNamespaces(*current, IncludeNode, &namespaceHash, tagNamesToSkip);
     }
 
-    if (!childrenOnly && targetNode.isElementNode())
+    if (!childrenOnly && targetNode.isElementNode()) {
         appendEndTag(toElement(targetNode));
+        flushMarkupToSink(m_sinkChunkLength);
+    }
 }
 
 String MarkupAccumulator::resolveURLIfNeeded(const Element& element, const String& urlString) const
@@ -62,6 +62,14 @@ enum SerializationType {
     ForcedXML
 };
 
+// Receives serialized markup in chunks while it is being produced, so that
+// large subtrees can be consumed without building the whole string first.
+class MarkupSink {
+public:
+    virtual ~MarkupSink() { }
+    virtual void appendMarkupChunk(const String&) = 0;
+};
+
 class MarkupAccumulator {
     WTF_MAKE_NONCOPYABLE(MarkupAccumulator);
     STACK_ALLOCATED();
@@ -70,6 +78,10 @@ public:
     virtual ~MarkupAccumulator();
 
     String serializeNodes(Node& targetNode, EChildrenOnly, Vector<QualifiedName>* tagNamesToSkip = 0);
+    // Streams the markup to |sink|. Chunks are only emitted at element
+    // boundaries, so they never split a tag or the contents of a text node.
+    void serializeNodes(Node& targetNode, EChildrenOnly, MarkupSink&, Vector<QualifiedName>* tagNamesToSkip = 0);
+    void setSinkChunkLengthForTesting(size_t length) { m_sinkChunkLength = length; }
 
     static void appendComment(StringBuilder&, const String&);
 
@@ -110,9 +122,13 @@ private:
     String resolveURLIfNeeded(const Element&, const String&) const;
     void appendQuotedURLAttributeValue(StringBuilder&, const Element&, const Attribute&);
     void serializeNodesWithNamespaces(Node& targetNode, EChildrenOnly, const Namespaces*, Vector<QualifiedName>* tagNamesToSkip);
+    void serializeNodesInternal(Node& targetNode, EChildrenOnly, Vector<QualifiedName>* tagNamesToSkip);
     bool serializeAsHTMLDocument(const Node&) const;
+    void flushMarkupToSink(size_t minimumLength);
 
     StringBuilder m_markup;
+    MarkupSink* m_sink;
+    size_t m_sinkChunkLength;
     const EAbsoluteURLs m_resolveURLsMethod;
     SerializationType m_serializationType;
 };
@@ -0,0 +1,109 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/editing/MarkupAccumulator.h"
+
+#include "core/dom/Document.h"
+#include "core/editing/EncodingMarkupSink.h"
+#include "core/html/HTMLElement.h"
+#include "core/testing/DummyPageHolder.h"
+#include "wtf/text/CString.h"
+#include "wtf/text/StringBuilder.h"
+#include "wtf/text/TextEncoding.h"
+#include <gtest/gtest.h>
+
+using namespace blink;
+
+namespace {
+
+class CollectingMarkupSink FINAL : public MarkupSink {
+public:
+    CollectingMarkupSink() : m_chunkCount(0) { }
+
+    virtual void appendMarkupChunk(const String& chunk) OVERRIDE
+    {
+        EXPECT_FALSE(chunk.isEmpty());
+        m_markup.append(chunk);
+        ++m_chunkCount;
+    }
+
+    String markup() const { return m_markup.toString(); }
+    size_t chunkCount() const { return m_chunkCount; }
+
+private:
+    StringBuilder m_markup;
+    size_t m_chunkCount;
+};
+
+class MarkupAccumulatorTest : public ::testing::Test {
+protected:
+    Document& document() const { return m_dummyPageHolder->document(); }
+    void setBodyContent(const String& content) { document().body()->setInnerHTML(content, ASSERT_NO_EXCEPTION); }
+
+    String serialize()
+    {
+        MarkupAccumulator accumulator(0, DoNotResolveURLs);
+        return accumulator.serializeNodes(document(), IncludeNode);
+    }
+
+    void expectStreamedEncodingIsIdentical(const char* encodingName)
+    {
+        WTF::TextEncoding encoding(encodingName);
+        ASSERT_TRUE(encoding.isValid());
+        CString expected = encoding.normalizeAndEncode(serialize(), WTF::EntitiesForUnencodables);
+
+        MarkupAccumulator accumulator(0, DoNotResolveURLs);
+        accumulator.setSinkChunkLengthForTesting(1);
+        EncodingMarkupSink sink(encoding);
+        accumulator.serializeNodes(document(), IncludeNode, sink);
+        RefPtr<SharedBuffer> streamed = sink.finish();
+
+        EXPECT_EQ(std::string(expected.data(), expected.length()), std::string(streamed->data(), streamed->size())) << encodingName;
+    }
+
+private:
+    virtual void SetUp() OVERRIDE
+    {
+        m_dummyPageHolder = DummyPageHolder::create(IntSize(800, 600));
+    }
+
+    OwnPtr<DummyPageHolder> m_dummyPageHolder;
+};
+
+// Text that doesn't survive being normalized or encoded piecewise: U+0338
+// composes with a preceding '>' into U+226F, U+0301 with 'e' into U+00E9, and
+// the Japanese text makes ISO-2022-JP switch character sets.
+static const UChar mixedContent[] = {
+    '<', 'p', '>', 'e', '<', '/', 'p', '>', 0x0338,
+    '<', 'b', '>', 0x65E5, 0x672C, '<', '/', 'b', '>', 0x8A9E,
+    '<', 'i', '>', 'e', '<', '/', 'i', '>', 0x0301, 0x0301,
+    '<', 's', '>', 0x20AC, '<', '/', 's', '>', 0xD83D, 0xDE00, 0
+};
+
+TEST_F(MarkupAccumulatorTest, StreamedMarkupMatchesSerializedMarkup)
+{
+    setBodyContent(String(mixedContent));
+
+    MarkupAccumulator accumulator(0, DoNotResolveURLs);
+    accumulator.setSinkChunkLengthForTesting(1);
+    CollectingMarkupSink sink;
+    accumulator.serializeNodes(document(), IncludeNode, sink);
+
+    EXPECT_EQ(serialize(), sink.markup());
+    EXPECT_LT(1u, sink.chunkCount());
+}
+
+TEST_F(MarkupAccumulatorTest, StreamedEncodingMatchesWholeEncoding)
+{
+    setBodyContent(String(mixedContent));
+
+    expectStreamedEncodingIsIdentical("UTF-8");
+    expectStreamedEncodingIsIdentical("UTF-16LE");
+    expectStreamedEncodingIsIdentical("windows-1252");
+    expectStreamedEncodingIsIdentical("Shift_JIS");
+    expectStreamedEncodingIsIdentical("ISO-2022-JP");
+}
+
+} // namespace
@@ -34,9 +34,14 @@
 #include "platform/TraceEvent.h"
 
 #include "wtf/Vector.h"
+#include <algorithm>
 
 namespace blink {
 
+// Loaded images further from the viewport than the nearest this many aren't kept in the pass.
+// They are decoded when they are painted.
+static const size_t maxObjectsWaitingForDecode = 128;
+
 ResourceLoadPriorityOptimizer* ResourceLoadPriorityOptimizer::resourceLoadPriorityOptimizer()
 {
     DEFINE_STATIC_LOCAL(ResourceLoadPriorityOptimizer, s_renderLoadOptimizer, ());
@@ -81,6 +86,7 @@ void ResourceLoadPriorityOptimizer::updateAllImageResourcePriorities()
     TRACE_EVENT0("blink", "ResourceLoadPriorityOptimizer::updateAllImageResourcePriorities");
 
     m_imageResources.clear();
+    m_objectsWaitingForDecode.clear();
 
     Vector<RenderObject*> objectsToRemove;
     for (RenderObjectSet::iterator it = m_objects.begin(); it != m_objects.end(); ++it) {
@@ -89,11 +95,24 @@ void ResourceLoadPriorityOptimizer::updateAllImageResourcePriorities()
             objectsToRemove.append(obj);
         }
     }
+
+    if (m_objectsWaitingForDecode.size() > maxObjectsWaitingForDecode) {
+        std::nth_element(m_objectsWaitingForDecode.begin(), m_objectsWaitingForDecode.begin() + maxObjectsWaitingForDecode, m_objectsWaitingForDecode.end());
+        for (size_t i = maxObjectsWaitingForDecode; i < m_objectsWaitingForDecode.size(); ++i)
+            objectsToRemove.append(m_objectsWaitingForDecode[i].second);
+    }
+    m_objectsWaitingForDecode.clear();
+
     m_objects.removeAll(objectsToRemove);
 
     updateImageResourcesWithLoadPriority();
 }
 
+void ResourceLoadPriorityOptimizer::notifyObjectWaitingForDecode(RenderObject* renderer, float distanceFromViewport)
+{
+    m_objectsWaitingForDecode.append(std::make_pair(distanceFromViewport, renderer));
+}
+
 void ResourceLoadPriorityOptimizer::updateImageResourcesWithLoadPriority()
 {
     for (ImageResourceMap::iterator it = m_imageResources.begin(); it != m_imageResources.end(); ++it) {
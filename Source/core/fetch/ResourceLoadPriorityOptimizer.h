@@ -38,6 +38,7 @@
 #include "wtf/HashMap.h"
 #include "wtf/HashSet.h"
 #include "wtf/OwnPtr.h"
+#include "wtf/Vector.h"
 
 namespace blink {
 
@@ -52,6 +53,11 @@ public:
     void addRenderObject(RenderObject*);
     void removeRenderObject(RenderObject*);
 
+    // Called during updateAllImageResourcePriorities() by renderers that stay in the pass with a
+    // loaded image until it comes near enough to the viewport to be decoded ahead of painting.
+    // Only the nearest ones stay, the others are removed at the end of the pass.
+    void notifyObjectWaitingForDecode(RenderObject*, float distanceFromViewport);
+
     static ResourceLoadPriorityOptimizer* resourceLoadPriorityOptimizer();
 
 private:
@@ -73,6 +79,9 @@ private:
 
     typedef HashSet<RenderObject*> RenderObjectSet;
     RenderObjectSet m_objects;
+
+    typedef std::pair<float, RenderObject*> ObjectWaitingForDecode;
+    Vector<ObjectWaitingForDecode> m_objectsWaitingForDecode;
 };
 
 }
@@ -55,6 +55,7 @@
 #include "core/page/FrameTree.h"
 #include "core/page/Page.h"
 #include "core/page/scrolling/ScrollingCoordinator.h"
+#include "core/rendering/RenderBlockFlow.h"
 #include "core/rendering/RenderCounter.h"
 #include "core/rendering/RenderEmbeddedObject.h"
 #include "core/rendering/RenderLayer.h"
@@ -79,6 +80,7 @@
 #include "platform/fonts/FontCache.h"
 #include "platform/geometry/FloatRect.h"
 #include "platform/graphics/GraphicsContext.h"
+#include "platform/graphics/GraphicsLayer.h"
 #include "platform/graphics/GraphicsLayerDebugInfo.h"
 #include "platform/scroll/ScrollAnimator.h"
 #include "platform/scroll/ScrollbarTheme.h"
@@ -1166,6 +1168,69 @@ void FrameView::removeViewportConstrainedObject(RenderObject* object)
     }
 }
 
+void FrameView::addFixedBackgroundObject(RenderObject* object)
+{
+    if (!m_fixedBackgroundObjects)
+        m_fixedBackgroundObjects = adoptPtr(new FixedBackgroundObjectSet);
+    m_fixedBackgroundObjects->add(object);
+}
+
+void FrameView::removeFixedBackgroundObject(RenderObject* object)
+{
+    if (m_fixedBackgroundObjects)
+        m_fixedBackgroundObjects->remove(object);
+}
+
+void FrameView::addSkippedContentBlock(RenderBlockFlow* block)
+{
+    if (!m_skippedContentBlocks)
+        m_skippedContentBlocks = adoptPtr(new SkippedContentBlockSet);
+    m_skippedContentBlocks->add(block);
+}
+
+void FrameView::removeSkippedContentBlock(RenderBlockFlow* block)
+{
+    if (m_skippedContentBlocks)
+        m_skippedContentBlocks->remove(block);
+}
+
+void FrameView::scheduleLayoutOfSkippedContentNearViewport()
+{
+    // Blocks that come near the viewport during layout are picked up in performPostLayoutTasks().
+    if (!m_skippedContentBlocks || m_skippedContentBlocks->isEmpty() || isInPerformLayout())
+        return;
+
+    // Requesting layout doesn't change the set, but collect the blocks first to be safe.
+    Vector<RenderBlockFlow*> blocksNearViewport;
+    LayoutUnit scrollSlack = LayoutUnit::max();
+    SkippedContentBlockSet::const_iterator end = m_skippedContentBlocks->end();
+    for (SkippedContentBlockSet::const_iterator it = m_skippedContentBlocks->begin(); it != end; ++it) {
+        LayoutUnit distance = (*it)->scrollDistanceToContentLayout();
+        if (!distance)
+            blocksNearViewport.append(*it);
+        else
+            scrollSlack = std::min(scrollSlack, distance);
+    }
+    m_skippedContentScrollDistance = 0;
+    m_skippedContentScrollSlack = scrollSlack;
+
+    for (size_t i = 0; i < blocksNearViewport.size(); ++i)
+        blocksNearViewport[i]->requestContentLayout();
+}
+
+void FrameView::scheduleLayoutOfSkippedContentAfterScroll(const IntSize& scrollDelta)
+{
+    if (!m_skippedContentBlocks || m_skippedContentBlocks->isEmpty())
+        return;
+
+    // The scrolled content moves by at most the summed deltas along either axis, so no skipped
+    // block can have come near the viewport before the sum reaches the distance to the closest one.
+    m_skippedContentScrollDistance += std::max(abs(scrollDelta.width()), abs(scrollDelta.height()));
+    if (m_skippedContentScrollDistance < m_skippedContentScrollSlack)
+        return;
+    scheduleLayoutOfSkippedContentNearViewport();
+}
+
 LayoutRect FrameView::viewportConstrainedVisibleContentRect() const
 {
     LayoutRect viewportRect = visibleContentRect();
@@ -1520,6 +1585,18 @@ void FrameView::scrollPositionChanged()
         m_didScrollTimer.stop();
     m_didScrollTimer.startOneShot(resourcePriorityUpdateDelayAfterScroll, FROM_HERE);
 
+    // Fixed backgrounds are painted relative to the viewport, so their recordings are out of date.
+    if (m_fixedBackgroundObjects) {
+        FixedBackgroundObjectSet::const_iterator end = m_fixedBackgroundObjects->end();
+        for (FixedBackgroundObjectSet::const_iterator it = m_fixedBackgroundObjects->begin(); it != end; ++it) {
+            if (RenderLayer* layer = (*it)->enclosingLayer())
+                layer->invalidateDisplayListCacheOfPaintingLayer();
+        }
+    }
+
+    scheduleLayoutOfSkippedContentAfterScroll(scrollPosition() - m_lastScrollPositionForSkippedContent);
+    m_lastScrollPositionForSkippedContent = scrollPosition();
+
     if (AXObjectCache* cache = m_frame->document()->existingAXObjectCache())
         cache->handleScrollPositionChanged(this);
 
@@ -1766,6 +1843,16 @@ static bool isObjectAncestorContainerOf(RenderObject* ancestor, RenderObject* de
     return false;
 }
 
+// Returns the innermost relayout boundary that contains both subtrees, if any.
+static RenderObject* commonRelayoutBoundary(RenderObject* first, RenderObject* second)
+{
+    for (RenderObject* r = first->container(); r; r = r->container()) {
+        if (r->isRelayoutBoundary() && isObjectAncestorContainerOf(r, second))
+            return r;
+    }
+    return 0;
+}
+
 void FrameView::scheduleRelayoutOfSubtree(RenderObject* relayoutRoot)
 {
     ASSERT(m_frame->view() == this);
@@ -1792,6 +1879,13 @@ void FrameView::scheduleRelayoutOfSubtree(RenderObject* relayoutRoot)
                 m_layoutSubtreeRoot->markContainingBlocksForLayout(false, relayoutRoot);
                 m_layoutSubtreeRoot = relayoutRoot;
                 ASSERT(!m_layoutSubtreeRoot->container() || !m_layoutSubtreeRoot->container()->needsLayout());
+            } else if (RenderObject* commonRoot = isSubtreeLayout() ? commonRelayoutBoundary(m_layoutSubtreeRoot, relayoutRoot) : 0) {
+                // Two independent subtrees are dirty. Re-root at the innermost boundary containing
+                // both, so only the dirty parts of that boundary are laid out again.
+                m_layoutSubtreeRoot->markContainingBlocksForLayout(false, commonRoot);
+                relayoutRoot->markContainingBlocksForLayout(false, commonRoot);
+                m_layoutSubtreeRoot = commonRoot;
+                ASSERT(!m_layoutSubtreeRoot->container() || !m_layoutSubtreeRoot->container()->needsLayout());
             } else {
                 // Just do a full relayout
                 if (isSubtreeLayout())
@@ -2038,6 +2132,9 @@ void FrameView::performPostLayoutTasks()
 
     scheduleUpdateWidgetsIfNecessary();
 
+    // Layout may have moved skipped content closer to the viewport.
+    scheduleLayoutOfSkippedContentNearViewport();
+
     if (Page* page = m_frame->page()) {
         if (ScrollingCoordinator* scrollingCoordinator = page->scrollingCoordinator())
             scrollingCoordinator->notifyLayoutUpdated();
@@ -2632,6 +2729,10 @@ void FrameView::updateLayoutAndStyleForPainting()
     // Updating layout can run script, which can tear down the FrameView.
     RefPtr<FrameView> protector(this);
 
+    // Paint invalidations issued while the lifecycle is brought up to date are
+    // coalesced per composited layer before they are sent to the compositor.
+    GraphicsLayer::PaintInvalidationCoalescingScope paintInvalidationCoalescingScope;
+
     updateLayoutAndStyleIfNeededRecursive();
 
     updateWidgetPositionsIfNeeded();
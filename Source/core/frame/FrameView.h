@@ -47,6 +47,7 @@ class LocalFrame;
 class KURL;
 class Node;
 class Page;
+class RenderBlockFlow;
 class RenderBox;
 class RenderEmbeddedObject;
 class RenderObject;
@@ -182,6 +183,21 @@ public:
     const ViewportConstrainedObjectSet* viewportConstrainedObjects() const { return m_viewportConstrainedObjects.get(); }
     bool hasViewportConstrainedObjects() const { return m_viewportConstrainedObjects && m_viewportConstrainedObjects->size() > 0; }
 
+    // Renderers with fixed background images, which display lists cached by RenderLayers can't
+    // replay after a scroll. Only tracked when LayerDisplayListCaching is enabled.
+    typedef HashSet<RenderObject*> FixedBackgroundObjectSet;
+    void addFixedBackgroundObject(RenderObject*);
+    void removeFixedBackgroundObject(RenderObject*);
+
+    // Blocks that skipped laying out their content because it was far from the viewport.
+    typedef HashSet<RenderBlockFlow*> SkippedContentBlockSet;
+    void addSkippedContentBlock(RenderBlockFlow*);
+    void removeSkippedContentBlock(RenderBlockFlow*);
+    void scheduleLayoutOfSkippedContentNearViewport();
+    // Only looks for skipped blocks near the viewport once the content has scrolled far enough
+    // to bring the closest one near it.
+    void scheduleLayoutOfSkippedContentAfterScroll(const IntSize& scrollDelta);
+
     void handleLoadCompleted();
 
     void updateAnnotatedRegions();
@@ -510,6 +526,13 @@ private:
     OwnPtr<ScrollableAreaSet> m_scrollableAreas;
     OwnPtr<ResizerAreaSet> m_resizerAreas;
     OwnPtr<ViewportConstrainedObjectSet> m_viewportConstrainedObjects;
+    OwnPtr<FixedBackgroundObjectSet> m_fixedBackgroundObjects;
+    OwnPtr<SkippedContentBlockSet> m_skippedContentBlocks;
+    // Distance scrolled since the last look for skipped blocks near the viewport, and the scroll
+    // distance to the closest skipped block at that time.
+    LayoutUnit m_skippedContentScrollDistance;
+    LayoutUnit m_skippedContentScrollSlack;
+    IntPoint m_lastScrollPositionForSkippedContent;
     OwnPtr<FrameViewAutoSizeInfo> m_autoSizeInfo;
 
     float m_visibleContentScaleFactor;
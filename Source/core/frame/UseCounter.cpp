@@ -499,6 +499,7 @@ int UseCounter::mapCSSPropertyIdToCSSSampleIdForHistogram(int id)
     case CSSPropertyGrid: return 453;
     case CSSPropertyAll: return 454;
     case CSSPropertyJustifyItems: return 455;
+    case CSSPropertyContentSkipping: return 456;
 
     // 1. Add new features above this line (don't change the assigned numbers of the existing
     // items).
@@ -521,7 +522,7 @@ int UseCounter::mapCSSPropertyIdToCSSSampleIdForHistogram(int id)
     return 0;
 }
 
-static int maximumCSSSampleId() { return 455; }
+static int maximumCSSSampleId() { return 456; }
 
 void UseCounter::muteForInspector()
 {
@@ -593,6 +594,15 @@ void UseCounter::count(const Document& document, Feature feature)
     host->useCounter().recordMeasurement(feature);
 }
 
+bool UseCounter::isCounted(const Document& document, Feature feature)
+{
+    FrameHost* host = document.frameHost();
+    if (!host)
+        return false;
+    UseCounter& useCounter = host->useCounter();
+    return useCounter.m_countBits && useCounter.m_countBits->quickGet(feature);
+}
+
 void UseCounter::count(const ExecutionContext* context, Feature feature)
 {
     if (!context)
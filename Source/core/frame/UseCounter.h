@@ -537,6 +537,9 @@ public:
     void count(CSSParserContext, CSSPropertyID);
     void count(Feature);
 
+    // Returns whether the feature has been counted for the document's page.
+    static bool isCounted(const Document&, Feature);
+
     // "countDeprecation" sets the bit for this feature to 1, and sends a deprecation
     // warning to the console. Repeated calls are ignored.
     //
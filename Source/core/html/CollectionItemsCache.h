@@ -50,6 +50,13 @@ public:
     NodeType* nodeAt(const Collection&, unsigned index);
     void invalidate();
 
+    bool isListValid() const { return m_listValid; }
+    // Caches the nodes among |candidates| that the collection contains, instead of
+    // traversing. The candidates must be in document order and include every node
+    // of the collection; null stands for no candidates.
+    template <typename Candidates>
+    void setListFromCandidates(const Collection&, const Candidates*);
+
 private:
     ptrdiff_t allocationSize() const { return m_cachedList.capacity() * sizeof(NodeType*); }
     static void reportExtraMemoryCostForCollectionItemsCache(ptrdiff_t diff)
@@ -105,6 +112,27 @@ unsigned CollectionItemsCache<Collection, NodeType>::nodeCount(const Collection&
     return this->cachedNodeCount();
 }
 
+template <typename Collection, typename NodeType>
+template <typename Candidates>
+void CollectionItemsCache<Collection, NodeType>::setListFromCandidates(const Collection& collection, const Candidates* candidates)
+{
+    ASSERT(!m_listValid);
+    ptrdiff_t oldCapacity = allocationSize();
+    if (candidates) {
+        typename Candidates::const_iterator end = candidates->end();
+        for (typename Candidates::const_iterator it = candidates->begin(); it != end; ++it) {
+            NodeType* node = *it;
+            if (collection.elementMatches(*node))
+                m_cachedList.append(node);
+        }
+    }
+    if (ptrdiff_t diff = allocationSize() - oldCapacity)
+        reportExtraMemoryCostForCollectionItemsCache(diff);
+
+    this->setCachedNodeCount(m_cachedList.size());
+    m_listValid = true;
+}
+
 template <typename Collection, typename NodeType>
 inline NodeType* CollectionItemsCache<Collection, NodeType>::nodeAt(const Collection& collection, unsigned index)
 {
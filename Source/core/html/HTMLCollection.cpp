@@ -26,6 +26,8 @@
 
 #include "core/HTMLNames.h"
 #include "core/dom/ClassCollection.h"
+#include "core/dom/Document.h"
+#include "core/dom/DocumentElementIndex.h"
 #include "core/dom/ElementTraversal.h"
 #include "core/dom/NodeRareData.h"
 #include "core/html/DocumentNameCollection.h"
@@ -36,6 +38,7 @@
 #include "core/html/HTMLOptionsCollection.h"
 #include "core/html/HTMLTagCollection.h"
 #include "core/html/WindowNameCollection.h"
+#include "platform/RuntimeEnabledFeatures.h"
 #include "wtf/HashSet.h"
 
 namespace blink {
@@ -194,14 +197,55 @@ void HTMLCollection::invalidateCache(Document* oldDocument) const
 
 unsigned HTMLCollection::length() const
 {
+    updateItemsFromElementIndexIfPossible();
     return m_collectionItemsCache.nodeCount(*this);
 }
 
 Element* HTMLCollection::item(unsigned offset) const
 {
+    updateItemsFromElementIndexIfPossible();
     return m_collectionItemsCache.nodeAt(*this, offset);
 }
 
+void HTMLCollection::updateItemsFromElementIndexIfPossible() const
+{
+    if (m_collectionItemsCache.isListValid() || !RuntimeEnabledFeatures::elementCollectionIndexEnabled())
+        return;
+    // The index only covers the document's own tree.
+    if (!ownerNode().isDocumentNode())
+        return;
+    Document& document = toDocument(ownerNode());
+
+    switch (type()) {
+    case TagCollectionType: {
+        const AtomicString& localName = toTagCollection(*this).localName();
+        if (localName == starAtom)
+            return;
+        m_collectionItemsCache.setListFromCandidates(*this, document.ensureElementIndex().elementsWithLocalName(localName));
+        return;
+    }
+    case HTMLTagCollectionType: {
+        // HTML elements are matched by the lowered name, others by the name as given, so
+        // a name with upper case letters would need two lists merged.
+        const HTMLTagCollection& collection = toHTMLTagCollection(*this);
+        if (collection.localName() == starAtom || collection.localName() != collection.loweredLocalName())
+            return;
+        m_collectionItemsCache.setListFromCandidates(*this, document.ensureElementIndex().elementsWithLocalName(collection.localName()));
+        return;
+    }
+    case ClassCollectionType: {
+        const SpaceSplitString& classNames = toClassCollection(*this).classNames();
+        if (!classNames.size())
+            return;
+        // Elements that have all the classes are among those that have the first one.
+        m_collectionItemsCache.setListFromCandidates(*this, document.ensureElementIndex().elementsWithClass(classNames[0]));
+        return;
+    }
+    default:
+        return;
+    }
+}
+
 static inline bool isMatchingHTMLElement(const HTMLCollection& htmlCollection, const HTMLElement& element)
 {
     switch (htmlCollection.type()) {
@@ -57,6 +57,7 @@ public:
     bool isEmpty() const { return m_collectionItemsCache.isEmpty(*this); }
     bool hasExactlyOneItem() const { return m_collectionItemsCache.hasExactlyOneNode(*this); }
     bool elementMatches(const Element&) const;
+    bool hasValidItemsCacheForTesting() const { return m_collectionItemsCache.isListValid(); }
 
     // CollectionIndexCache API.
     bool canTraverseBackward() const { return !overridesItemAfter(); }
@@ -127,6 +128,10 @@ protected:
     }
 
 private:
+    // Fills the items cache from the document's element index, if this collection
+    // can be served by it and the ElementCollectionIndex feature is enabled.
+    void updateItemsFromElementIndexIfPossible() const;
+
     void invalidateIdNameCacheMaps(Document* oldDocument = 0) const
     {
         if (!hasValidIdNameCache())
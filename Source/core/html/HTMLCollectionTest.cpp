@@ -0,0 +1,141 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/html/HTMLCollection.h"
+
+#include "core/HTMLNames.h"
+#include "core/dom/ClassCollection.h"
+#include "core/dom/Comment.h"
+#include "core/dom/Document.h"
+#include "core/dom/TagCollection.h"
+#include "core/dom/Text.h"
+#include "core/html/HTMLElement.h"
+#include "core/testing/DummyPageHolder.h"
+#include "platform/RuntimeEnabledFeatures.h"
+#include <gtest/gtest.h>
+
+using namespace blink;
+
+namespace {
+
+class HTMLCollectionTest : public ::testing::Test {
+protected:
+    Document& document() const { return m_dummyPageHolder->document(); }
+    void setBodyContent(const String& content) { document().body()->setInnerHTML(content, ASSERT_NO_EXCEPTION); }
+    Element* elementById(const char* id) { return document().getElementById(AtomicString(id)); }
+
+    virtual void SetUp() OVERRIDE
+    {
+        m_elementCollectionIndexWasEnabled = RuntimeEnabledFeatures::elementCollectionIndexEnabled();
+        m_dummyPageHolder = DummyPageHolder::create(IntSize(800, 600));
+    }
+
+    virtual void TearDown() OVERRIDE
+    {
+        RuntimeEnabledFeatures::setElementCollectionIndexEnabled(m_elementCollectionIndexWasEnabled);
+    }
+
+private:
+    OwnPtr<DummyPageHolder> m_dummyPageHolder;
+    bool m_elementCollectionIndexWasEnabled;
+};
+
+TEST_F(HTMLCollectionTest, TagCollectionStaysCachedWhenTextOrCommentIsInserted)
+{
+    setBodyContent("<div id='container'><p></p></div>");
+    RefPtrWillBeRawPtr<TagCollection> paragraphs = document().getElementsByTagName("p");
+    EXPECT_EQ(1u, paragraphs->length());
+    EXPECT_TRUE(paragraphs->hasValidItemsCacheForTesting());
+
+    Element* container = elementById("container");
+    RefPtrWillBeRawPtr<Text> text = document().createTextNode("text");
+    container->appendChild(text);
+    container->appendChild(document().createComment("comment"));
+    text->setData("changed text");
+    EXPECT_TRUE(paragraphs->hasValidItemsCacheForTesting());
+
+    container->appendChild(document().createElement(HTMLNames::pTag, false));
+    EXPECT_FALSE(paragraphs->hasValidItemsCacheForTesting());
+    EXPECT_EQ(2u, paragraphs->length());
+}
+
+TEST_F(HTMLCollectionTest, ClassCollectionStaysCachedWhenClassIsUnchanged)
+{
+    setBodyContent("<div id='target' class='a b'></div><div class='a'></div>");
+    RefPtrWillBeRawPtr<ClassCollection> collection = document().getElementsByClassName("a");
+    EXPECT_EQ(2u, collection->length());
+    EXPECT_TRUE(collection->hasValidItemsCacheForTesting());
+
+    Element* target = elementById("target");
+    target->setAttribute(HTMLNames::classAttr, "a b");
+    EXPECT_TRUE(collection->hasValidItemsCacheForTesting());
+
+    target->setAttribute(HTMLNames::classAttr, "b");
+    EXPECT_FALSE(collection->hasValidItemsCacheForTesting());
+    EXPECT_EQ(1u, collection->length());
+}
+
+TEST_F(HTMLCollectionTest, ElementIndexKeepsDocumentOrder)
+{
+    RuntimeEnabledFeatures::setElementCollectionIndexEnabled(true);
+    setBodyContent("<p id='first' class='x'></p><div id='container'><p id='last' class='x'></p></div>");
+    RefPtrWillBeRawPtr<TagCollection> paragraphs = document().getElementsByTagName("p");
+    RefPtrWillBeRawPtr<ClassCollection> classX = document().getElementsByClassName("x");
+    ASSERT_EQ(2u, paragraphs->length());
+    EXPECT_EQ(elementById("first"), paragraphs->item(0));
+    EXPECT_EQ(elementById("last"), paragraphs->item(1));
+    ASSERT_TRUE(document().elementIndex());
+
+    // Inserted before the others, so the index has to reorder its list.
+    RefPtrWillBeRawPtr<Element> inserted = document().createElement(HTMLNames::pTag, false);
+    inserted->setAttribute(HTMLNames::classAttr, "x");
+    document().body()->insertBefore(inserted, elementById("first"));
+    ASSERT_EQ(3u, paragraphs->length());
+    EXPECT_EQ(inserted.get(), paragraphs->item(0));
+    EXPECT_EQ(elementById("first"), paragraphs->item(1));
+    EXPECT_EQ(elementById("last"), paragraphs->item(2));
+    ASSERT_EQ(3u, classX->length());
+    EXPECT_EQ(inserted.get(), classX->item(0));
+
+    // Class changes and removals are tracked.
+    elementById("first")->setAttribute(HTMLNames::classAttr, "y");
+    ASSERT_EQ(2u, classX->length());
+    EXPECT_EQ(inserted.get(), classX->item(0));
+    EXPECT_EQ(elementById("last"), classX->item(1));
+
+    elementById("container")->remove(ASSERT_NO_EXCEPTION);
+    ASSERT_EQ(2u, paragraphs->length());
+    EXPECT_EQ(1u, classX->length());
+    EXPECT_EQ(1u, document().getElementsByClassName("y")->length());
+    EXPECT_EQ(0u, document().getElementsByTagName("span")->length());
+}
+
+TEST_F(HTMLCollectionTest, ElementIndexMatchesTraversal)
+{
+    setBodyContent("<div class='a b'><span class='b'></span><DIV class='B'></DIV></div><template><div class='a'></div></template><svg><DIV class='a'/></svg>");
+    const char* tagNames[] = { "div", "DIV", "span", "svg", "*" };
+    const char* classNames[] = { "a", "b", "a b", "B", "c" };
+
+    Vector<unsigned> expectedLengths;
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(tagNames); ++i)
+        expectedLengths.append(document().getElementsByTagName(tagNames[i])->length());
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(classNames); ++i)
+        expectedLengths.append(document().getElementsByClassName(classNames[i])->length());
+
+    // Collections are cached per document, so a fresh document is needed.
+    RuntimeEnabledFeatures::setElementCollectionIndexEnabled(true);
+    OwnPtr<DummyPageHolder> indexedPageHolder = DummyPageHolder::create(IntSize(800, 600));
+    Document& indexedDocument = indexedPageHolder->document();
+    indexedDocument.body()->setInnerHTML(document().body()->innerHTML(), ASSERT_NO_EXCEPTION);
+
+    size_t index = 0;
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(tagNames); ++i)
+        EXPECT_EQ(expectedLengths[index++], indexedDocument.getElementsByTagName(tagNames[i])->length()) << tagNames[i];
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(classNames); ++i)
+        EXPECT_EQ(expectedLengths[index++], indexedDocument.getElementsByClassName(classNames[i])->length()) << classNames[i];
+    EXPECT_TRUE(indexedDocument.elementIndex());
+}
+
+} // namespace
@@ -41,6 +41,8 @@ public:
 
     bool elementMatches(const Element&) const;
 
+    const AtomicString& loweredLocalName() const { return m_loweredLocalName; }
+
 private:
     HTMLTagCollection(ContainerNode& rootNode, const AtomicString& localName);
 
@@ -46,6 +46,7 @@
 #include "core/dom/Document.h"
 #include "core/dom/Element.h"
 #include "core/dom/Text.h"
+#include "core/editing/EncodingMarkupSink.h"
 #include "core/editing/MarkupAccumulator.h"
 #include "core/fetch/FontResource.h"
 #include "core/fetch/ImageResource.h"
@@ -209,9 +210,11 @@ void PageSerializer::serializeFrame(LocalFrame* frame)
 
     WillBeHeapVector<RawPtrWillBeMember<Node> > serializedNodes;
     SerializerMarkupAccumulator accumulator(this, document, &serializedNodes);
-    String text = accumulator.serializeNodes(document, IncludeNode);
-    CString frameHTML = textEncoding.normalizeAndEncode(text, WTF::EntitiesForUnencodables);
-    m_resources->append(SerializedResource(url, document.suggestedMIMEType(), SharedBuffer::create(frameHTML.data(), frameHTML.length())));
+    // Encodes markup as it is serialized, so that the whole frame never has to be
+    // held both as a String and as encoded bytes.
+    EncodingMarkupSink sink(textEncoding);
+    accumulator.serializeNodes(document, IncludeNode, sink);
+    m_resources->append(SerializedResource(url, document.suggestedMIMEType(), sink.finish()));
     m_resourceURLs.add(url);
 
     for (WillBeHeapVector<RawPtrWillBeMember<Node> >::iterator iter = serializedNodes.begin(); iter != serializedNodes.end(); ++iter) {
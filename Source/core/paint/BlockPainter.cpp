@@ -168,8 +168,11 @@ void BlockPainter::paintObject(PaintInfo& paintInfo, const LayoutPoint& paintOff
     if (paintPhase == PaintPhaseBlockBackground || paintInfo.paintRootBackgroundOnly())
         return;
 
+    // The descendants of a block that skipped content layout are not painted.
+    bool paintContent = !m_renderBlock.isSkippingContentLayout();
+
     // 2. paint contents
-    if (paintPhase != PaintPhaseSelfOutline) {
+    if (paintPhase != PaintPhaseSelfOutline && paintContent) {
         if (m_renderBlock.hasColumns())
             paintColumnContents(paintInfo, scrolledOffset);
         else
@@ -179,11 +182,11 @@ void BlockPainter::paintObject(PaintInfo& paintInfo, const LayoutPoint& paintOff
     // 3. paint selection
     // FIXME: Make this work with multi column layouts. For now don't fill gaps.
     bool isPrinting = m_renderBlock.document().printing();
-    if (!isPrinting && !m_renderBlock.hasColumns())
+    if (!isPrinting && !m_renderBlock.hasColumns() && paintContent)
         paintSelection(paintInfo, scrolledOffset); // Fill in gaps in selection on lines and between blocks.
 
     // 4. paint floats.
-    if (paintPhase == PaintPhaseFloat || paintPhase == PaintPhaseSelection || paintPhase == PaintPhaseTextClip) {
+    if (paintContent && (paintPhase == PaintPhaseFloat || paintPhase == PaintPhaseSelection || paintPhase == PaintPhaseTextClip)) {
         if (m_renderBlock.hasColumns())
             paintColumnContents(paintInfo, scrolledOffset, true);
         else
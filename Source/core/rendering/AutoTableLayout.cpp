@@ -27,6 +27,7 @@
 #include "core/rendering/RenderTableCol.h"
 #include "core/rendering/RenderTableSection.h"
 #include "core/rendering/TextAutosizer.h"
+#include <algorithm>
 
 namespace blink {
 
@@ -41,12 +42,44 @@ AutoTableLayout::~AutoTableLayout()
 {
 }
 
-void AutoTableLayout::recalcColumn(unsigned effCol)
+struct SpanCell {
+    SpanCell(RenderTableCell* spanningCell, unsigned originColumn, unsigned originRow)
+        : cell(spanningCell)
+        , effCol(originColumn)
+        , row(originRow)
+    {
+    }
+
+    RenderTableCell* cell;
+    unsigned effCol;
+    unsigned row;
+};
+
+// Spanning cells are distributed narrowest span first. Cells with the same span
+// are ordered by origin column, last first, and then by row, last first.
+static bool spanCellLessThan(const SpanCell& a, const SpanCell& b)
+{
+    unsigned aSpan = a.cell->colSpan();
+    unsigned bSpan = b.cell->colSpan();
+    if (aSpan != bSpan)
+        return aSpan < bSpan;
+    if (a.effCol != b.effCol)
+        return a.effCol > b.effCol;
+    return a.row > b.row;
+}
+
+void AutoTableLayout::recalcColumns()
 {
-    Layout& columnLayout = m_layoutStruct[effCol];
+    unsigned nEffCols = m_layoutStruct.size();
 
-    RenderTableCell* fixedContributor = 0;
-    RenderTableCell* maxContributor = 0;
+    // Walk the cells row by row, which matches the layout of the section grids in memory,
+    // and keep the per column state that a column by column walk would have.
+    Vector<RenderTableCell*> fixedContributors(nEffCols);
+    Vector<RenderTableCell*> maxContributors(nEffCols);
+    fixedContributors.fill(0);
+    maxContributors.fill(0);
+    Vector<SpanCell> spanCells;
+    unsigned rowIndex = 0;
 
     for (RenderObject* child = m_table->children()->firstChild(); child; child = child->nextSibling()) {
         if (child->isRenderTableCol()){
@@ -57,84 +90,99 @@ void AutoTableLayout::recalcColumn(unsigned effCol)
         } else if (child->isTableSection()) {
             RenderTableSection* section = toRenderTableSection(child);
             unsigned numRows = section->numRows();
-            for (unsigned i = 0; i < numRows; i++) {
-                RenderTableSection::CellStruct current = section->cellAt(i, effCol);
-                RenderTableCell* cell = current.primaryCell();
-
-                if (current.inColSpan || !cell)
-                    continue;
-
-                bool cellHasContent = cell->children()->firstChild() || cell->style()->hasBorder() || cell->style()->hasPadding() || cell->style()->hasBackground();
-                if (cellHasContent)
-                    columnLayout.emptyCellsOnly = false;
-
-                // A cell originates in this column. Ensure we have
-                // a min/max width of at least 1px for this column now.
-                columnLayout.minLogicalWidth = std::max<int>(columnLayout.minLogicalWidth, cellHasContent ? 1 : 0);
-                columnLayout.maxLogicalWidth = std::max<int>(columnLayout.maxLogicalWidth, 1);
-
-                if (cell->colSpan() == 1) {
-                    columnLayout.minLogicalWidth = std::max<int>(cell->minPreferredLogicalWidth(), columnLayout.minLogicalWidth);
-                    if (cell->maxPreferredLogicalWidth() > columnLayout.maxLogicalWidth) {
-                        columnLayout.maxLogicalWidth = cell->maxPreferredLogicalWidth();
-                        maxContributor = cell;
-                    }
+            for (unsigned i = 0; i < numRows; i++, rowIndex++) {
+                for (unsigned effCol = 0; effCol < nEffCols; effCol++) {
+                    const RenderTableSection::CellStruct& current = section->cellAt(i, effCol);
+                    RenderTableCell* cell = current.primaryCell();
+
+                    if (current.inColSpan || !cell)
+                        continue;
+
+                    Layout& columnLayout = m_layoutStruct[effCol];
+                    RenderTableCell*& fixedContributor = fixedContributors[effCol];
+                    RenderTableCell*& maxContributor = maxContributors[effCol];
+
+                    bool cellHasContent = cell->children()->firstChild() || cell->style()->hasBorder() || cell->style()->hasPadding() || cell->style()->hasBackground();
+                    if (cellHasContent)
+                        columnLayout.emptyCellsOnly = false;
+
+                    // A cell originates in this column. Ensure we have
+                    // a min/max width of at least 1px for this column now.
+                    columnLayout.minLogicalWidth = std::max<int>(columnLayout.minLogicalWidth, cellHasContent ? 1 : 0);
+                    columnLayout.maxLogicalWidth = std::max<int>(columnLayout.maxLogicalWidth, 1);
+
+                    if (cell->colSpan() == 1) {
+                        columnLayout.minLogicalWidth = std::max<int>(cell->minPreferredLogicalWidth(), columnLayout.minLogicalWidth);
+                        if (cell->maxPreferredLogicalWidth() > columnLayout.maxLogicalWidth) {
+                            columnLayout.maxLogicalWidth = cell->maxPreferredLogicalWidth();
+                            maxContributor = cell;
+                        }
 
-                    // All browsers implement a size limit on the cell's max width.
-                    // Our limit is based on KHTML's representation that used 16 bits widths.
-                    // FIXME: Other browsers have a lower limit for the cell's max width.
-                    const int cCellMaxWidth = 32760;
-                    Length cellLogicalWidth = cell->styleOrColLogicalWidth();
-                    // FIXME: calc() on tables should be handled consistently with other lengths. See bug: https://crbug.com/382725
-                    if (cellLogicalWidth.isCalculated())
-                        cellLogicalWidth = Length(); // Make it Auto
-                    if (cellLogicalWidth.value() > cCellMaxWidth)
-                        cellLogicalWidth.setValue(cCellMaxWidth);
-                    if (cellLogicalWidth.isNegative())
-                        cellLogicalWidth.setValue(0);
-                    switch (cellLogicalWidth.type()) {
-                    case Fixed:
-                        // ignore width=0
-                        if (cellLogicalWidth.isPositive() && !columnLayout.logicalWidth.isPercent()) {
-                            int logicalWidth = cell->adjustBorderBoxLogicalWidthForBoxSizing(cellLogicalWidth.value());
-                            if (columnLayout.logicalWidth.isFixed()) {
-                                // Nav/IE weirdness
-                                if ((logicalWidth > columnLayout.logicalWidth.value())
-                                    || ((columnLayout.logicalWidth.value() == logicalWidth) && (maxContributor == cell))) {
+                        // All browsers implement a size limit on the cell's max width.
+                        // Our limit is based on KHTML's representation that used 16 bits widths.
+                        // FIXME: Other browsers have a lower limit for the cell's max width.
+                        const int cCellMaxWidth = 32760;
+                        Length cellLogicalWidth = cell->styleOrColLogicalWidth();
+                        // FIXME: calc() on tables should be handled consistently with other lengths. See bug: https://crbug.com/382725
+                        if (cellLogicalWidth.isCalculated())
+                            cellLogicalWidth = Length(); // Make it Auto
+                        if (cellLogicalWidth.value() > cCellMaxWidth)
+                            cellLogicalWidth.setValue(cCellMaxWidth);
+                        if (cellLogicalWidth.isNegative())
+                            cellLogicalWidth.setValue(0);
+                        switch (cellLogicalWidth.type()) {
+                        case Fixed:
+                            // ignore width=0
+                            if (cellLogicalWidth.isPositive() && !columnLayout.logicalWidth.isPercent()) {
+                                int logicalWidth = cell->adjustBorderBoxLogicalWidthForBoxSizing(cellLogicalWidth.value());
+                                if (columnLayout.logicalWidth.isFixed()) {
+                                    // Nav/IE weirdness
+                                    if ((logicalWidth > columnLayout.logicalWidth.value())
+                                        || ((columnLayout.logicalWidth.value() == logicalWidth) && (maxContributor == cell))) {
+                                        columnLayout.logicalWidth.setValue(Fixed, logicalWidth);
+                                        fixedContributor = cell;
+                                    }
+                                } else {
                                     columnLayout.logicalWidth.setValue(Fixed, logicalWidth);
                                     fixedContributor = cell;
                                 }
-                            } else {
-                                columnLayout.logicalWidth.setValue(Fixed, logicalWidth);
-                                fixedContributor = cell;
                             }
+                            break;
+                        case Percent:
+                            m_hasPercent = true;
+                            if (cellLogicalWidth.isPositive() && (!columnLayout.logicalWidth.isPercent() || cellLogicalWidth.value() > columnLayout.logicalWidth.value()))
+                                columnLayout.logicalWidth = cellLogicalWidth;
+                            break;
+                        default:
+                            break;
                         }
-                        break;
-                    case Percent:
-                        m_hasPercent = true;
-                        if (cellLogicalWidth.isPositive() && (!columnLayout.logicalWidth.isPercent() || cellLogicalWidth.value() > columnLayout.logicalWidth.value()))
-                            columnLayout.logicalWidth = cellLogicalWidth;
-                        break;
-                    default:
-                        break;
+                    } else if (!effCol || section->primaryCellAt(i, effCol - 1) != cell) {
+                        // This spanning cell originates in this column.
+                        spanCells.append(SpanCell(cell, effCol, rowIndex));
                     }
-                } else if (!effCol || section->primaryCellAt(i, effCol - 1) != cell) {
-                    // This spanning cell originates in this column. Insert the cell into spanning cells list.
-                    insertSpanCell(cell);
                 }
             }
         }
     }
 
-    // Nav/IE weirdness
-    if (columnLayout.logicalWidth.isFixed()) {
-        if (m_table->document().inQuirksMode() && columnLayout.maxLogicalWidth > columnLayout.logicalWidth.value() && fixedContributor != maxContributor) {
-            columnLayout.logicalWidth = Length();
-            fixedContributor = 0;
+    for (unsigned effCol = 0; effCol < nEffCols; effCol++) {
+        Layout& columnLayout = m_layoutStruct[effCol];
+
+        // Nav/IE weirdness
+        if (columnLayout.logicalWidth.isFixed()) {
+            if (m_table->document().inQuirksMode() && columnLayout.maxLogicalWidth > columnLayout.logicalWidth.value() && fixedContributors[effCol] != maxContributors[effCol])
+                columnLayout.logicalWidth = Length();
         }
+
+        columnLayout.maxLogicalWidth = std::max(columnLayout.maxLogicalWidth, columnLayout.minLogicalWidth);
     }
 
-    columnLayout.maxLogicalWidth = std::max(columnLayout.maxLogicalWidth, columnLayout.minLogicalWidth);
+    // Sorting once replaces a sorted insertion per spanning cell, which was quadratic
+    // for tables with a spanning cell in every row.
+    std::sort(spanCells.begin(), spanCells.end(), spanCellLessThan);
+    m_spanCells.resize(spanCells.size());
+    for (size_t i = 0; i < spanCells.size(); ++i)
+        m_spanCells[i] = spanCells[i].cell;
 }
 
 void AutoTableLayout::fullRecalc()
@@ -145,7 +193,6 @@ void AutoTableLayout::fullRecalc()
     unsigned nEffCols = m_table->numEffCols();
     m_layoutStruct.resize(nEffCols);
     m_layoutStruct.fill(Layout());
-    m_spanCells.fill(0);
 
     Length groupLogicalWidth;
     unsigned currentColumn = 0;
@@ -173,8 +220,7 @@ void AutoTableLayout::fullRecalc()
             groupLogicalWidth = Length();
     }
 
-    for (unsigned i = 0; i < nEffCols; i++)
-        recalcColumn(i);
+    recalcColumns();
 }
 
 // FIXME: This needs to be adapted for vertical writing modes.
@@ -464,33 +510,6 @@ int AutoTableLayout::calcEffectiveLogicalWidth()
     return std::min(maxLogicalWidth, INT_MAX / 2);
 }
 
-/* gets all cells that originate in a column and have a cellspan > 1
-   Sorts them by increasing cellspan
-*/
-void AutoTableLayout::insertSpanCell(RenderTableCell *cell)
-{
-    ASSERT_ARG(cell, cell && cell->colSpan() != 1);
-    if (!cell || cell->colSpan() == 1)
-        return;
-
-    unsigned size = m_spanCells.size();
-    if (!size || m_spanCells[size-1] != 0) {
-        m_spanCells.grow(size + 10);
-        for (unsigned i = 0; i < 10; i++)
-            m_spanCells[size+i] = 0;
-        size += 10;
-    }
-
-    // add them in sort. This is a slow algorithm, and a binary search or a fast sorting after collection would be better
-    unsigned pos = 0;
-    unsigned span = cell->colSpan();
-    while (pos < m_spanCells.size() && m_spanCells[pos] && span > m_spanCells[pos]->colSpan())
-        pos++;
-    memmove(m_spanCells.data()+pos+1, m_spanCells.data()+pos, (size-pos-1)*sizeof(RenderTableCell *));
-    m_spanCells[pos] = cell;
-}
-
-
 void AutoTableLayout::layout()
 {
     // table layout based on the values collected in the layout structure.
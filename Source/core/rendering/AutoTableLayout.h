@@ -43,12 +43,10 @@ public:
 
 private:
     void fullRecalc();
-    void recalcColumn(unsigned effCol);
+    void recalcColumns();
 
     int calcEffectiveLogicalWidth();
 
-    void insertSpanCell(RenderTableCell*);
-
     struct Layout {
         Layout()
             : minLogicalWidth(0)
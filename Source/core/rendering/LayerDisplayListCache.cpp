@@ -0,0 +1,63 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/rendering/LayerDisplayListCache.h"
+
+#include "wtf/MainThread.h"
+
+namespace blink {
+
+// The recordings of all layers together are limited to this estimated size.
+static const size_t maxTotalEstimatedBytes = 128 * 1024 * 1024;
+
+size_t LayerDisplayListCache::s_totalEstimatedBytes = 0;
+
+LayerDisplayListCache::~LayerDisplayListCache()
+{
+    clear();
+}
+
+void LayerDisplayListCache::setRecordingBounds(const IntRect& bounds)
+{
+    if (bounds == m_recordingBounds)
+        return;
+    m_recordingBounds = bounds;
+    clear();
+}
+
+bool LayerDisplayListCache::canRecord() const
+{
+    // The recordings of this layer are already counted.
+    if (m_estimatedBytes)
+        return true;
+    return s_totalEstimatedBytes + estimatedBytes(m_recordingBounds) <= maxTotalEstimatedBytes;
+}
+
+void LayerDisplayListCache::setDisplayList(Phase phase, PassRefPtr<DisplayList> displayList)
+{
+    ASSERT(isMainThread());
+    m_displayLists[phase] = displayList;
+    if (!m_estimatedBytes) {
+        m_estimatedBytes = estimatedBytes(m_recordingBounds);
+        s_totalEstimatedBytes += m_estimatedBytes;
+    }
+}
+
+void LayerDisplayListCache::clear()
+{
+    ASSERT(isMainThread());
+    for (size_t i = 0; i < NumberOfPhases; ++i)
+        m_displayLists[i].clear();
+    ASSERT(s_totalEstimatedBytes >= m_estimatedBytes);
+    s_totalEstimatedBytes -= m_estimatedBytes;
+    m_estimatedBytes = 0;
+}
+
+size_t LayerDisplayListCache::estimatedBytes(const IntRect& recordingBounds)
+{
+    return static_cast<size_t>(recordingBounds.width()) * recordingBounds.height() * 4;
+}
+
+} // namespace blink
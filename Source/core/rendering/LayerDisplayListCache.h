@@ -0,0 +1,113 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef LayerDisplayListCache_h
+#define LayerDisplayListCache_h
+
+#include "core/rendering/LayerFragment.h"
+#include "core/rendering/LayerPaintingInfo.h"
+#include "platform/geometry/FloatSize.h"
+#include "platform/graphics/DisplayList.h"
+#include "wtf/PassOwnPtr.h"
+#include "wtf/RefPtr.h"
+
+namespace blink {
+
+class RenderLayer;
+
+// Recordings of what a RenderLayer paints for its own renderers, i.e. everything but its child
+// layers. They are recorded without culling to the damage rect, so that they can be replayed
+// for any damage rect as long as the layer paints with the same key and none of the renderers
+// it paints has invalidated paint. See RenderLayer::paintLayerContents().
+class LayerDisplayListCache {
+    WTF_MAKE_NONCOPYABLE(LayerDisplayListCache); WTF_MAKE_FAST_ALLOCATED;
+public:
+    enum Phase {
+        BackgroundPhase,
+        ForegroundPhase,
+        NumberOfPhases
+    };
+
+    struct Key {
+        Key()
+            : rootLayer(0)
+            , paintFlags(0)
+            , deviceScaleFactor(1)
+            , scale(1, 1)
+        {
+        }
+
+        bool operator==(const Key& other) const
+        {
+            return rootLayer == other.rootLayer
+                && paintFlags == other.paintFlags
+                && deviceScaleFactor == other.deviceScaleFactor
+                && scale == other.scale
+                && subPixelAccumulation == other.subPixelAccumulation
+                && fragment.layerBounds == other.fragment.layerBounds
+                && fragment.backgroundRect == other.fragment.backgroundRect
+                && fragment.foregroundRect == other.fragment.foregroundRect;
+        }
+        bool operator!=(const Key& other) const { return !(*this == other); }
+
+        // The layer the recordings are relative to. Only compared, never dereferenced.
+        const RenderLayer* rootLayer;
+        // Only the flags that change what the renderers paint, not which phases are painted.
+        PaintLayerFlags paintFlags;
+        float deviceScaleFactor;
+        // The scale of the context's transform, which images and text are rasterized for.
+        FloatSize scale;
+        LayoutSize subPixelAccumulation;
+        // The fragment of the layer computed without a damage rect.
+        LayerFragment fragment;
+    };
+
+    static PassOwnPtr<LayerDisplayListCache> create() { return adoptPtr(new LayerDisplayListCache); }
+    ~LayerDisplayListCache();
+
+    // Drops the recordings when they were made with a different key.
+    void setKey(const Key& key)
+    {
+        if (key == m_key)
+            return;
+        m_key = key;
+        clear();
+    }
+    const Key& key() const { return m_key; }
+
+    // The area the recordings may draw into, relative to the key's root layer. Changing it drops the recordings.
+    const IntRect& recordingBounds() const { return m_recordingBounds; }
+    void setRecordingBounds(const IntRect&);
+
+    // False if recording would take the recordings of all layers over the memory budget.
+    bool canRecord() const;
+
+    DisplayList* displayList(Phase phase) const { return m_displayLists[phase].get(); }
+    void setDisplayList(Phase, PassRefPtr<DisplayList>);
+
+    void clear();
+
+    // SkPicture doesn't report its size, so a layer's recordings are counted as taking as
+    // many bytes as a raster of their bounds.
+    static size_t estimatedBytes(const IntRect& recordingBounds);
+    static size_t totalEstimatedBytes() { return s_totalEstimatedBytes; }
+
+private:
+    LayerDisplayListCache()
+        : m_estimatedBytes(0)
+    {
+    }
+
+    static size_t s_totalEstimatedBytes;
+
+    Key m_key;
+    IntRect m_recordingBounds;
+    RefPtr<DisplayList> m_displayLists[NumberOfPhases];
+    // Counted in s_totalEstimatedBytes while there are recordings.
+    size_t m_estimatedBytes;
+};
+
+} // namespace blink
+
+#endif // LayerDisplayListCache_h
@@ -0,0 +1,174 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/rendering/LayerDisplayListCache.h"
+
+#include "core/css/CSSPropertyNames.h"
+#include "core/rendering/RenderLayer.h"
+#include "core/rendering/RenderView.h"
+#include "core/rendering/RenderingTestHelper.h"
+#include "platform/RuntimeEnabledFeatures.h"
+#include "platform/graphics/GraphicsContext.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+
+namespace blink {
+
+namespace {
+
+class LayerDisplayListCacheTest : public RenderingTest {
+protected:
+    virtual void SetUp() OVERRIDE
+    {
+        m_layerDisplayListCachingEnabled = RuntimeEnabledFeatures::layerDisplayListCachingEnabled();
+        RuntimeEnabledFeatures::setLayerDisplayListCachingEnabled(true);
+        RenderingTest::SetUp();
+    }
+
+    virtual void TearDown() OVERRIDE
+    {
+        RuntimeEnabledFeatures::setLayerDisplayListCachingEnabled(m_layerDisplayListCachingEnabled);
+    }
+
+    LayerDisplayListCache* displayListCache(const char* id) const
+    {
+        return toRenderBoxModelObject(document().getElementById(id)->renderer())->layer()->displayListCacheForTesting();
+    }
+
+    DisplayList* foregroundDisplayList(const char* id) const
+    {
+        LayerDisplayListCache* cache = displayListCache(id);
+        return cache ? cache->displayList(LayerDisplayListCache::ForegroundPhase) : 0;
+    }
+
+    // Paints the document with the software backend.
+    void paint(SkBitmap& bitmap, float scale = 1)
+    {
+        document().view()->updateLayoutAndStyleForPainting();
+        bitmap.allocN32Pixels(800, 600);
+        bitmap.eraseColor(0);
+        SkCanvas canvas(bitmap);
+        GraphicsContext context(&canvas);
+        context.scale(scale, scale);
+        document().renderView()->layer()->paint(&context, LayoutRect(0, 0, 800, 600));
+    }
+
+    void paint()
+    {
+        SkBitmap bitmap;
+        paint(bitmap);
+    }
+
+private:
+    bool m_layerDisplayListCachingEnabled;
+};
+
+static const char* layerHTML =
+    "<div id='layer' style='position: relative; width: 100px; height: 100px; background-color: green'>"
+    "<div id='child' style='width: 50px; height: 50px; background-color: blue'></div>"
+    "</div>";
+
+static bool bitmapsAreEqual(const SkBitmap& first, const SkBitmap& second)
+{
+    SkAutoLockPixels firstLock(first);
+    SkAutoLockPixels secondLock(second);
+    return first.getSize() == second.getSize() && !memcmp(first.getPixels(), second.getPixels(), first.getSize());
+}
+
+TEST_F(LayerDisplayListCacheTest, RecordingsAreReplayedUntilInvalidated)
+{
+    setBodyInnerHTML(layerHTML);
+    paint();
+    RefPtr<DisplayList> recorded = foregroundDisplayList("layer");
+    ASSERT_TRUE(recorded);
+    EXPECT_TRUE(displayListCache("layer")->displayList(LayerDisplayListCache::BackgroundPhase));
+
+    paint();
+    EXPECT_EQ(recorded.get(), foregroundDisplayList("layer"));
+
+    document().getElementById("child")->setInlineStyleProperty(CSSPropertyBackgroundColor, "red");
+    document().view()->updateLayoutAndStyleForPainting();
+    EXPECT_FALSE(foregroundDisplayList("layer"));
+
+    paint();
+    EXPECT_TRUE(foregroundDisplayList("layer"));
+    EXPECT_NE(recorded.get(), foregroundDisplayList("layer"));
+}
+
+TEST_F(LayerDisplayListCacheTest, ReplayMatchesPainting)
+{
+    setBodyInnerHTML(layerHTML);
+    SkBitmap recorded;
+    paint(recorded);
+    SkBitmap replayed;
+    paint(replayed);
+
+    RuntimeEnabledFeatures::setLayerDisplayListCachingEnabled(false);
+    SkBitmap painted;
+    paint(painted);
+
+    EXPECT_TRUE(bitmapsAreEqual(painted, recorded));
+    EXPECT_TRUE(bitmapsAreEqual(painted, replayed));
+}
+
+TEST_F(LayerDisplayListCacheTest, ScaleChangeDropsRecordings)
+{
+    setBodyInnerHTML(layerHTML);
+    paint();
+    RefPtr<DisplayList> recorded = foregroundDisplayList("layer");
+    ASSERT_TRUE(recorded);
+
+    SkBitmap bitmap;
+    paint(bitmap, 2);
+    EXPECT_TRUE(foregroundDisplayList("layer"));
+    EXPECT_NE(recorded.get(), foregroundDisplayList("layer"));
+}
+
+TEST_F(LayerDisplayListCacheTest, FixedBackgroundRecordingsAreDroppedOnScroll)
+{
+    setBodyInnerHTML(
+        "<div id='layer' style='position: relative; width: 100px; height: 100px; background: linear-gradient(green, blue) fixed'></div>"
+        "<div id='other' style='position: relative; width: 100px; height: 100px; background-color: green'></div>"
+        "<div style='height: 2000px'></div>");
+    paint();
+    ASSERT_TRUE(displayListCache("layer")->displayList(LayerDisplayListCache::BackgroundPhase));
+    ASSERT_TRUE(displayListCache("other")->displayList(LayerDisplayListCache::BackgroundPhase));
+
+    document().view()->setScrollPosition(IntPoint(0, 50));
+    EXPECT_FALSE(displayListCache("layer")->displayList(LayerDisplayListCache::BackgroundPhase));
+    EXPECT_TRUE(displayListCache("other")->displayList(LayerDisplayListCache::BackgroundPhase));
+}
+
+TEST(LayerDisplayListCacheBudgetTest, RecordingsAreCountedUntilCleared)
+{
+    size_t totalEstimatedBytes = LayerDisplayListCache::totalEstimatedBytes();
+    OwnPtr<LayerDisplayListCache> cache = LayerDisplayListCache::create();
+    cache->setRecordingBounds(IntRect(0, 0, 100, 100));
+    EXPECT_TRUE(cache->canRecord());
+
+    cache->setDisplayList(LayerDisplayListCache::BackgroundPhase, DisplayList::create(FloatRect(0, 0, 100, 100)));
+    cache->setDisplayList(LayerDisplayListCache::ForegroundPhase, DisplayList::create(FloatRect(0, 0, 100, 100)));
+    EXPECT_EQ(totalEstimatedBytes + LayerDisplayListCache::estimatedBytes(IntRect(0, 0, 100, 100)), LayerDisplayListCache::totalEstimatedBytes());
+
+    // New bounds drop the recordings.
+    cache->setRecordingBounds(IntRect(0, 0, 200, 200));
+    EXPECT_FALSE(cache->displayList(LayerDisplayListCache::BackgroundPhase));
+    EXPECT_EQ(totalEstimatedBytes, LayerDisplayListCache::totalEstimatedBytes());
+
+    cache->setDisplayList(LayerDisplayListCache::BackgroundPhase, DisplayList::create(FloatRect(0, 0, 200, 200)));
+    cache.clear();
+    EXPECT_EQ(totalEstimatedBytes, LayerDisplayListCache::totalEstimatedBytes());
+}
+
+TEST(LayerDisplayListCacheBudgetTest, RecordingsOverBudgetAreRefused)
+{
+    OwnPtr<LayerDisplayListCache> cache = LayerDisplayListCache::create();
+    cache->setRecordingBounds(IntRect(0, 0, 8192, 8192));
+    EXPECT_FALSE(cache->canRecord());
+}
+
+} // namespace
+
+} // namespace blink
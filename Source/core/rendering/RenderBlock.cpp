@@ -2418,7 +2418,8 @@ bool RenderBlock::nodeAtPoint(const HitTestRequest& request, HitTestResult& resu
                 checkChildren = locationInContainer.intersects(clipRect);
         }
     }
-    if (checkChildren) {
+    // The descendants of a block that skipped content layout have no up-to-date geometry.
+    if (checkChildren && !isSkippingContentLayout()) {
         // Hit test descendants first.
         LayoutSize scrolledOffset(localOffset);
         if (hasOverflowClip())
@@ -47,6 +47,7 @@
 #include "core/rendering/TextAutosizer.h"
 #include "core/rendering/line/LineWidth.h"
 #include "core/rendering/svg/SVGTextRunRenderingContext.h"
+#include "platform/RuntimeEnabledFeatures.h"
 #include "platform/text/BidiTextRun.h"
 
 namespace blink {
@@ -347,6 +348,21 @@ void RenderBlockFlow::layoutBlock(bool relayoutChildren)
     // at least once and so that it always gives a reliable result reflecting the latest layout.
     m_hasOnlySelfCollapsingChildren = false;
 
+    if (shouldSkipContentLayout()) {
+        layoutWithoutContent();
+        return;
+    }
+
+    if (m_rareData)
+        m_rareData->m_contentLayoutRequested = false;
+    if (isSkippingContentLayout()) {
+        setIsSkippingContentLayout(false);
+        if (FrameView* frameView = this->frameView())
+            frameView->removeSkippedContentBlock(this);
+        // Our width may have changed while the children were skipped.
+        relayoutChildren = true;
+    }
+
     if (!relayoutChildren && simplifiedLayout())
         return;
 
@@ -390,6 +406,116 @@ void RenderBlockFlow::layoutBlock(bool relayoutChildren)
     clearNeedsLayout();
 }
 
+// Content is skipped once it is more than two viewports away and laid out again when it comes
+// within one viewport, so small position changes don't toggle the skipping back and forth.
+static const int contentSkippingViewportDistance = 2;
+static const int contentLayoutViewportDistance = 1;
+
+static bool hasDescendantLayers(const RenderBlockFlow& block)
+{
+    if (block.hasLayer())
+        return block.layer()->firstChild();
+
+    for (RenderObject* descendant = block.slowFirstChild(); descendant; descendant = descendant->nextInPreOrder(&block)) {
+        if (descendant->hasLayer())
+            return true;
+    }
+    return false;
+}
+
+bool RenderBlockFlow::shouldSkipContentLayout() const
+{
+    if (!RuntimeEnabledFeatures::cssContentSkippingEnabled() || style()->contentSkipping().isMaxSizeNone())
+        return false;
+
+    if (m_rareData && m_rareData->m_contentLayoutRequested)
+        return false;
+
+    // Only skip blocks whose descendants can't affect anything outside of them.
+    if (isDocumentElement() || isInline() || isFloatingOrOutOfFlowPositioned() || isTableCell() || hasColumns() || multiColumnFlowThread())
+        return false;
+    if (view()->layoutState()->isPaginated())
+        return false;
+
+    // A block that is already skipped stays skipped until FrameView finds it near the viewport, or
+    // until one of its descendants gets a layer (see RenderObject::requestContentLayoutOfSkippedAncestors()).
+    if (isSkippingContentLayout())
+        return true;
+    if (!distanceFromViewport(contentSkippingViewportDistance))
+        return false;
+
+    // Positioned descendants, widgets and composited content all have layers, which are positioned
+    // after layout. The subtree walk is only done when the block is about to start skipping.
+    return !hasDescendantLayers(*this);
+}
+
+LayoutUnit RenderBlockFlow::distanceFromViewport(int viewports) const
+{
+    FrameView* frameView = this->frameView();
+    if (!frameView)
+        return 0;
+
+    IntRect visibleContentRect = frameView->visibleContentRect();
+    LayoutRect nearViewportRect(visibleContentRect);
+    nearViewportRect.inflateX(visibleContentRect.width() * viewports);
+    nearViewportRect.inflateY(visibleContentRect.height() * viewports);
+
+    // Our logical top has already been estimated by our containing block, so this is close
+    // to our final position even when called during layout.
+    LayoutRect absoluteRect(LayoutPoint(localToAbsolute()), size().expandedTo(LayoutSize(1, 1)));
+    // The rects can't meet before one of them moves this far horizontally or vertically. Both
+    // distances are negative if they overlap.
+    LayoutUnit horizontalDistance = std::max(nearViewportRect.x() - absoluteRect.maxX(), absoluteRect.x() - nearViewportRect.maxX());
+    LayoutUnit verticalDistance = std::max(nearViewportRect.y() - absoluteRect.maxY(), absoluteRect.y() - nearViewportRect.maxY());
+    return std::max<LayoutUnit>(0, std::max(horizontalDistance, verticalDistance));
+}
+
+LayoutUnit RenderBlockFlow::scrollDistanceToContentLayout() const
+{
+    ASSERT(isSkippingContentLayout());
+    return distanceFromViewport(contentLayoutViewportDistance);
+}
+
+void RenderBlockFlow::requestContentLayout()
+{
+    ASSERT(isSkippingContentLayout());
+    ensureRareData().m_contentLayoutRequested = true;
+    setNeedsLayoutAndFullPaintInvalidation();
+}
+
+void RenderBlockFlow::layoutWithoutContent()
+{
+    if (!isSkippingContentLayout()) {
+        setIsSkippingContentLayout(true);
+        if (FrameView* frameView = this->frameView())
+            frameView->addSkippedContentBlock(this);
+        // Our children are no longer painted.
+        setShouldDoFullPaintInvalidation(true);
+    }
+
+    updateLogicalWidth();
+
+    // Keep the content height from the last time our children were laid out. A block that has
+    // never been laid out uses the placeholder height from style.
+    LayoutUnit contentLogicalHeight = everHadLayout()
+        ? std::max<LayoutUnit>(0, logicalHeight() - borderAndPaddingLogicalHeight() - scrollbarLogicalHeight())
+        : minimumValueForLength(style()->contentSkipping(), 0);
+    setLogicalHeight(borderAndPaddingLogicalHeight() + scrollbarLogicalHeight() + contentLogicalHeight);
+    updateLogicalHeight();
+
+    // Floats of skipped descendants must not affect the layout of our siblings.
+    if (m_floatingObjects)
+        m_floatingObjects->clear();
+
+    clearAllOverflows();
+    addVisualEffectOverflow();
+
+    updateLayerTransformAfterLayout();
+    updateScrollInfoAfterLayout();
+
+    clearNeedsLayout();
+}
+
 inline bool RenderBlockFlow::layoutBlockFlow(bool relayoutChildren, LayoutUnit &pageLogicalHeight, SubtreeLayoutScope& layoutScope)
 {
     LayoutUnit oldLeft = logicalLeft();
@@ -1935,6 +2061,28 @@ void RenderBlockFlow::createFloatingObjects()
     m_floatingObjects = adoptPtr(new FloatingObjects(this, isHorizontalWritingMode()));
 }
 
+void RenderBlockFlow::willBeDestroyed()
+{
+    if (isSkippingContentLayout()) {
+        // Don't use this->view() because the document's renderView has been set to 0 during destruction.
+        if (LocalFrame* frame = this->frame()) {
+            if (FrameView* frameView = frame->view())
+                frameView->removeSkippedContentBlock(this);
+        }
+    }
+
+    RenderBlock::willBeDestroyed();
+}
+
+void RenderBlockFlow::invalidatePaintOfSubtreesIfNeeded(const PaintInvalidationState& childPaintInvalidationState)
+{
+    // Skipped descendants are neither laid out nor painted.
+    if (isSkippingContentLayout())
+        return;
+
+    RenderBlock::invalidatePaintOfSubtreesIfNeeded(childPaintInvalidationState);
+}
+
 void RenderBlockFlow::styleWillChange(StyleDifference diff, const RenderStyle& newStyle)
 {
     RenderStyle* oldStyle = style();
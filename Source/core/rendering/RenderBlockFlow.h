@@ -60,6 +60,11 @@ public:
 
     virtual void layoutBlock(bool relayoutChildren) OVERRIDE;
 
+    // Called by FrameView on blocks that skipped content layout. The content is laid out again
+    // once the distance is zero, i.e. when the block comes near the viewport.
+    LayoutUnit scrollDistanceToContentLayout() const;
+    void requestContentLayout();
+
     virtual void computeOverflow(LayoutUnit oldClientAfterEdge, bool recomputeFloats = false) OVERRIDE;
 
     virtual void deleteLineBoxTree() OVERRIDE FINAL;
@@ -210,9 +215,12 @@ protected:
 
     void createFloatingObjects();
 
+    virtual void willBeDestroyed() OVERRIDE;
     virtual void styleWillChange(StyleDifference, const RenderStyle& newStyle) OVERRIDE;
     virtual void styleDidChange(StyleDifference, const RenderStyle* oldStyle) OVERRIDE;
 
+    virtual void invalidatePaintOfSubtreesIfNeeded(const PaintInvalidationState& childPaintInvalidationState) OVERRIDE;
+
     void addOverflowFromFloats();
 
     LayoutUnit logicalRightOffsetForLine(LayoutUnit logicalTop, LayoutUnit fixedOffset, bool applyTextIndent, LayoutUnit logicalHeight = 0) const
@@ -233,6 +241,10 @@ protected:
 
 private:
     bool layoutBlockFlow(bool relayoutChildren, LayoutUnit& pageLogicalHeight, SubtreeLayoutScope&);
+
+    bool shouldSkipContentLayout() const;
+    LayoutUnit distanceFromViewport(int viewports) const;
+    void layoutWithoutContent();
     void layoutBlockChildren(bool relayoutChildren, SubtreeLayoutScope&, LayoutUnit beforeEdge, LayoutUnit afterEdge);
 
     void layoutBlockChild(RenderBox* child, MarginInfo&, LayoutUnit& previousFloatLogicalBottom);
@@ -360,6 +372,7 @@ public:
             , m_didBreakAtLineToAvoidWidow(false)
             , m_discardMarginBefore(false)
             , m_discardMarginAfter(false)
+            , m_contentLayoutRequested(false)
         {
         }
         void trace(Visitor*);
@@ -390,6 +403,7 @@ public:
         bool m_didBreakAtLineToAvoidWidow : 1;
         bool m_discardMarginBefore : 1;
         bool m_discardMarginAfter : 1;
+        bool m_contentLayoutRequested : 1;
     };
     LayoutUnit marginOffsetForSelfCollapsingBlock();
 
@@ -0,0 +1,89 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/rendering/RenderBlockFlow.h"
+
+#include "core/css/CSSPropertyNames.h"
+#include "core/rendering/RenderingTestHelper.h"
+#include "platform/RuntimeEnabledFeatures.h"
+
+namespace blink {
+
+namespace {
+
+class RenderBlockFlowContentSkippingTest : public RenderingTest {
+protected:
+    virtual void SetUp() OVERRIDE
+    {
+        m_contentSkippingEnabled = RuntimeEnabledFeatures::cssContentSkippingEnabled();
+        RuntimeEnabledFeatures::setCSSContentSkippingEnabled(true);
+        RenderingTest::SetUp();
+    }
+
+    virtual void TearDown() OVERRIDE
+    {
+        RuntimeEnabledFeatures::setCSSContentSkippingEnabled(m_contentSkippingEnabled);
+    }
+
+    RenderBlockFlow* renderBlockFlow(const char* id) const
+    {
+        return toRenderBlockFlow(document().getElementById(id)->renderer());
+    }
+
+    void scrollTo(int y)
+    {
+        document().view()->setScrollPosition(IntPoint(0, y));
+        document().view()->updateLayoutAndStyleIfNeededRecursive();
+    }
+
+private:
+    bool m_contentSkippingEnabled;
+};
+
+// The viewport is 600px high, so content more than two viewports below it is skipped.
+static const char* farContentHTML =
+    "<div id='near' style='content-skipping: 100px'><div style='height: 500px'></div></div>"
+    "<div style='height: 3000px'></div>"
+    "<div id='far' style='content-skipping: 100px'><div id='content' style='height: 500px'></div></div>";
+
+TEST_F(RenderBlockFlowContentSkippingTest, FarContentIsSkipped)
+{
+    setBodyInnerHTML(farContentHTML);
+
+    EXPECT_FALSE(renderBlockFlow("near")->isSkippingContentLayout());
+    EXPECT_EQ(LayoutUnit(500), renderBlockFlow("near")->logicalHeight());
+
+    // A block that was never laid out uses the placeholder height.
+    EXPECT_TRUE(renderBlockFlow("far")->isSkippingContentLayout());
+    EXPECT_EQ(LayoutUnit(100), renderBlockFlow("far")->logicalHeight());
+}
+
+TEST_F(RenderBlockFlowContentSkippingTest, ContentIsLaidOutWhenScrolledNear)
+{
+    setBodyInnerHTML(farContentHTML);
+    ASSERT_TRUE(renderBlockFlow("far")->isSkippingContentLayout());
+
+    scrollTo(100);
+    EXPECT_TRUE(renderBlockFlow("far")->isSkippingContentLayout());
+
+    scrollTo(3000);
+    EXPECT_FALSE(renderBlockFlow("far")->isSkippingContentLayout());
+    EXPECT_EQ(LayoutUnit(500), renderBlockFlow("far")->logicalHeight());
+}
+
+TEST_F(RenderBlockFlowContentSkippingTest, DescendantLayerStopsSkipping)
+{
+    setBodyInnerHTML(farContentHTML);
+    ASSERT_TRUE(renderBlockFlow("far")->isSkippingContentLayout());
+
+    document().getElementById("content")->setInlineStyleProperty(CSSPropertyPosition, "relative");
+    document().view()->updateLayoutAndStyleIfNeededRecursive();
+    EXPECT_FALSE(renderBlockFlow("far")->isSkippingContentLayout());
+    EXPECT_EQ(LayoutUnit(500), renderBlockFlow("far")->logicalHeight());
+}
+
+} // namespace
+
+} // namespace blink
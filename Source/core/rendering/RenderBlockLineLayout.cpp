@@ -41,6 +41,7 @@
 #include "core/rendering/line/RenderTextInfo.h"
 #include "core/rendering/line/WordMeasurement.h"
 #include "core/rendering/svg/SVGRootInlineBox.h"
+#include "platform/TraceEvent.h"
 #include "platform/fonts/Character.h"
 #include "platform/text/BidiResolver.h"
 #include "wtf/RefCountedLeakCounter.h"
@@ -739,7 +740,7 @@ void RenderBlockFlow::layoutRunsAndFloats(LineLayoutState& layoutState)
     // if we determine that we're able to synchronize after handling all our dirty lines.
     InlineIterator cleanLineStart;
     BidiStatus cleanLineBidiStatus;
-    if (!layoutState.isFullLayout() && startLine)
+    if (!layoutState.isFullLayout() && !layoutState.floatListChanged() && startLine)
         determineEndPosition(layoutState, startLine, cleanLineStart, cleanLineBidiStatus);
 
     if (startLine) {
@@ -858,6 +859,7 @@ void RenderBlockFlow::layoutRunsAndFloatsInRange(LineLayoutState& layoutState,
             resolver.markCurrentRunEmpty(); // FIXME: This can probably be replaced by an ASSERT (or just removed).
 
             if (lineBox) {
+                layoutState.incrementLayoutLineCount();
                 lineBox->setLineBreakInfo(endOfLine.object(), endOfLine.offset(), resolver.status());
                 if (layoutState.usesPaintInvalidationBounds())
                     layoutState.updatePaintInvalidationRangeFromBox(lineBox);
@@ -874,6 +876,7 @@ void RenderBlockFlow::layoutRunsAndFloatsInRange(LineLayoutState& layoutState,
                         if (availableLogicalWidthForLine(oldLogicalHeight + adjustment, layoutState.lineInfo().isFirstLine()) != oldLineWidth) {
                             // We have to delete this line, remove all floats that got added, and let line layout re-run.
                             lineBox->deleteLine();
+                            layoutState.decrementLayoutLineCount();
                             endOfLine = restartLayoutRunsAndFloatsInRange(oldLogicalHeight, oldLogicalHeight + adjustment, lastFloatFromPreviousLine, resolver, previousEndofLine);
                             continue;
                         }
@@ -1602,6 +1605,11 @@ void RenderBlockFlow::layoutInlineChildren(bool relayoutChildren, LayoutUnit& pa
     // Ensure the new line boxes will be painted.
     if (isFullLayout && firstLineBox())
         setShouldDoFullPaintInvalidation(true);
+
+    // Counting the lines walks the whole line box list, so it only happens while tracing.
+    TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("blink.lineLayout"), "RenderBlockFlow::layoutInlineChildren",
+        "layoutLines", layoutState.layoutLineCount(),
+        "reusedLines", std::max(lineCount(), static_cast<int>(layoutState.layoutLineCount())) - static_cast<int>(layoutState.layoutLineCount()));
 }
 
 void RenderBlockFlow::checkFloatsInCleanLine(RootInlineBox* line, Vector<FloatWithRect>& floats, size_t& floatIndex, bool& encounteredNewFloat, bool& dirtiedByFloat)
@@ -1646,6 +1654,9 @@ RootInlineBox* RenderBlockFlow::determineStartPosition(LineLayoutState& layoutSt
         bool paginated = view()->layoutState() && view()->layoutState()->isPaginated();
         LayoutUnit paginationDelta = 0;
         size_t floatIndex = 0;
+        // The last clean line with a float that is still at its old place in the float list.
+        RootInlineBox* lastLineWithCleanFloat = 0;
+        bool encounteredNewFloat = false;
         for (curr = firstRootBox(); curr && !curr->isDirty(); curr = curr->nextRootBox()) {
             if (paginated) {
                 paginationDelta -= curr->paginationStrut();
@@ -1662,18 +1673,21 @@ RootInlineBox* RenderBlockFlow::determineStartPosition(LineLayoutState& layoutSt
                 }
             }
 
-            // If a new float has been inserted before this line or before its last known float, just do a full layout.
-            bool encounteredNewFloat = false;
+            size_t firstFloatIndex = floatIndex;
             checkFloatsInCleanLine(curr, layoutState.floats(), floatIndex, encounteredNewFloat, dirtiedByFloat);
-            if (encounteredNewFloat)
-                layoutState.markForFullLayout();
+            if (floatIndex != firstFloatIndex)
+                lastLineWithCleanFloat = curr;
 
-            if (dirtiedByFloat || layoutState.isFullLayout())
+            if (dirtiedByFloat || encounteredNewFloat || layoutState.isFullLayout())
                 break;
         }
-        // Check if a new float has been inserted after the last known float.
-        if (!curr && floatIndex < layoutState.floats().size())
-            layoutState.markForFullLayout();
+        // A float was inserted or removed after the last float that is still in place. The
+        // float list is in document order, so the lines before that float are not affected
+        // and only the lines from it on are laid out again.
+        if (encounteredNewFloat || (!curr && floatIndex < layoutState.floats().size())) {
+            layoutState.markFloatListChanged();
+            curr = lastLineWithCleanFloat ? lastLineWithCleanFloat : firstRootBox();
+        }
     }
 
     if (layoutState.isFullLayout()) {
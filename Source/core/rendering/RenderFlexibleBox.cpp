@@ -205,6 +205,7 @@ void RenderFlexibleBox::removeChild(RenderObject* child)
 {
     RenderBlock::removeChild(child);
     m_intrinsicSizeAlongMainAxis.remove(child);
+    m_relaidOutChildren.remove(child);
 }
 
 void RenderFlexibleBox::styleDidChange(StyleDifference diff, const RenderStyle* oldStyle)
@@ -602,9 +603,22 @@ static inline bool preferredMainAxisExtentDependsOnLayout(const Length& flexBasi
     return flexBasis.isAuto() || (flexBasis.isPercent() && hasInfiniteLineLength);
 }
 
-bool RenderFlexibleBox::childPreferredMainAxisContentExtentRequiresLayout(RenderBox& child, bool hasInfiniteLineLength) const
+bool RenderFlexibleBox::canReuseIntrinsicSizeAlongMainAxis(RenderBox& child, bool relayoutChildren) const
 {
-    return preferredMainAxisExtentDependsOnLayout(flexBasisForChild(child), hasInfiniteLineLength) && hasOrthogonalFlow(child);
+    if (child.needsLayout())
+        return false;
+
+    HashMap<const RenderObject*, IntrinsicSizeAlongMainAxis>::const_iterator it = m_intrinsicSizeAlongMainAxis.find(&child);
+    if (it == m_intrinsicSizeAlongMainAxis.end())
+        return false;
+    if (!relayoutChildren)
+        return true;
+
+    // Our own width changed, but the child's intrinsic logical height only depends on the logical width
+    // it is given. The override size has already been cleared, so this is the width a layout would use.
+    LogicalExtentComputedValues computedValues;
+    child.computeLogicalWidth(computedValues);
+    return computedValues.m_extent == it->value.childLogicalWidth;
 }
 
 LayoutUnit RenderFlexibleBox::preferredMainAxisContentExtentForChild(RenderBox& child, bool hasInfiniteLineLength, bool relayoutChildren)
@@ -618,13 +632,14 @@ LayoutUnit RenderFlexibleBox::preferredMainAxisContentExtentForChild(RenderBox&
     if (preferredMainAxisExtentDependsOnLayout(flexBasis, hasInfiniteLineLength)) {
         LayoutUnit mainAxisExtent;
         if (hasOrthogonalFlow(child)) {
-            if (child.needsLayout() || relayoutChildren) {
+            if (!canReuseIntrinsicSizeAlongMainAxis(child, relayoutChildren)) {
                 m_intrinsicSizeAlongMainAxis.remove(&child);
                 child.forceChildLayout();
-                m_intrinsicSizeAlongMainAxis.set(&child, child.logicalHeight());
+                m_intrinsicSizeAlongMainAxis.set(&child, IntrinsicSizeAlongMainAxis(child.logicalHeight(), child.logicalWidth()));
+                m_relaidOutChildren.add(&child);
             }
             ASSERT(m_intrinsicSizeAlongMainAxis.contains(&child));
-            mainAxisExtent = m_intrinsicSizeAlongMainAxis.get(&child);
+            mainAxisExtent = m_intrinsicSizeAlongMainAxis.get(&child).size;
         } else {
             mainAxisExtent = child.maxPreferredLogicalWidth();
         }
@@ -645,6 +660,7 @@ void RenderFlexibleBox::layoutFlexItems(bool relayoutChildren)
 
     Vector<LayoutUnit, 16> childSizes;
 
+    m_relaidOutChildren.clear();
     m_orderIterator.first();
     LayoutUnit crossAxisOffset = flowAwareBorderBefore() + flowAwarePaddingBefore();
     bool hasInfiniteLineLength = false;
@@ -659,7 +675,7 @@ void RenderFlexibleBox::layoutFlexItems(bool relayoutChildren)
             ASSERT(inflexibleItems.size() > 0);
         }
 
-        layoutAndPlaceChildren(crossAxisOffset, orderedChildren, childSizes, availableFreeSpace, relayoutChildren, lineContexts, hasInfiniteLineLength);
+        layoutAndPlaceChildren(crossAxisOffset, orderedChildren, childSizes, availableFreeSpace, relayoutChildren, lineContexts);
     }
     if (hasLineIfEmpty()) {
         // Even if computeNextFlexLine returns true, the flexbox might not have
@@ -1063,7 +1079,7 @@ bool RenderFlexibleBox::needToStretchChildLogicalHeight(RenderBox& child) const
     return isHorizontalFlow() && child.style()->height().isAuto();
 }
 
-void RenderFlexibleBox::layoutAndPlaceChildren(LayoutUnit& crossAxisOffset, const OrderedFlexItemList& children, const Vector<LayoutUnit, 16>& childSizes, LayoutUnit availableFreeSpace, bool relayoutChildren, Vector<LineContext>& lineContexts, bool hasInfiniteLineLength)
+void RenderFlexibleBox::layoutAndPlaceChildren(LayoutUnit& crossAxisOffset, const OrderedFlexItemList& children, const Vector<LayoutUnit, 16>& childSizes, LayoutUnit availableFreeSpace, bool relayoutChildren, Vector<LineContext>& lineContexts)
 {
     ASSERT(childSizes.size() == children.size());
 
@@ -1099,7 +1115,7 @@ void RenderFlexibleBox::layoutAndPlaceChildren(LayoutUnit& crossAxisOffset, cons
             resetAutoMarginsAndLogicalTopInCrossAxis(*child);
         }
         // We may have already forced relayout for orthogonal flowing children in preferredMainAxisContentExtentForChild.
-        bool forceChildRelayout = relayoutChildren && !childPreferredMainAxisContentExtentRequiresLayout(*child, hasInfiniteLineLength);
+        bool forceChildRelayout = relayoutChildren && !m_relaidOutChildren.contains(child);
         updateBlockChildDirtyBitsBeforeLayout(forceChildRelayout, child);
         child->layoutIfNeeded();
 
@@ -122,7 +122,7 @@ private:
     ItemPosition alignmentForChild(RenderBox& child) const;
     LayoutUnit mainAxisBorderAndPaddingExtentForChild(RenderBox& child) const;
     LayoutUnit preferredMainAxisContentExtentForChild(RenderBox& child, bool hasInfiniteLineLength, bool relayoutChildren = false);
-    bool childPreferredMainAxisContentExtentRequiresLayout(RenderBox& child, bool hasInfiniteLineLength) const;
+    bool canReuseIntrinsicSizeAlongMainAxis(RenderBox& child, bool relayoutChildren) const;
     bool needToStretchChildLogicalHeight(RenderBox& child) const;
 
     void layoutFlexItems(bool relayoutChildren);
@@ -151,7 +151,7 @@ private:
     void setLogicalOverrideSize(RenderBox& child, LayoutUnit childPreferredSize);
     void prepareChildForPositionedLayout(RenderBox& child, LayoutUnit mainAxisOffset, LayoutUnit crossAxisOffset, PositionedLayoutMode);
     size_t numberOfInFlowPositionedChildren(const OrderedFlexItemList&) const;
-    void layoutAndPlaceChildren(LayoutUnit& crossAxisOffset, const OrderedFlexItemList&, const Vector<LayoutUnit, 16>& childSizes, LayoutUnit availableFreeSpace, bool relayoutChildren, Vector<LineContext>&, bool hasInfiniteLineLength);
+    void layoutAndPlaceChildren(LayoutUnit& crossAxisOffset, const OrderedFlexItemList&, const Vector<LayoutUnit, 16>& childSizes, LayoutUnit availableFreeSpace, bool relayoutChildren, Vector<LineContext>&);
     void layoutColumnReverse(const OrderedFlexItemList&, LayoutUnit crossAxisOffset, LayoutUnit availableFreeSpace);
     void alignFlexLines(Vector<LineContext>&);
     void alignChildren(const Vector<LineContext>&);
@@ -159,8 +159,23 @@ private:
     void flipForRightToLeftColumn();
     void flipForWrapReverse(const Vector<LineContext>&, LayoutUnit crossAxisStartEdge);
 
-    // This is used to cache the preferred size for orthogonal flow children so we don't have to relayout to get it
-    HashMap<const RenderObject*, LayoutUnit> m_intrinsicSizeAlongMainAxis;
+    // This is used to cache the preferred size for orthogonal flow children so we don't have to relayout to get it.
+    // The size is stored with the logical width the child had when it was measured, since that is the only
+    // constraint it depends on; a clean child whose logical width is unchanged doesn't need to be measured again.
+    struct IntrinsicSizeAlongMainAxis {
+        IntrinsicSizeAlongMainAxis() { }
+        IntrinsicSizeAlongMainAxis(LayoutUnit intrinsicSize, LayoutUnit logicalWidth)
+            : size(intrinsicSize)
+            , childLogicalWidth(logicalWidth)
+        {
+        }
+
+        LayoutUnit size;
+        LayoutUnit childLogicalWidth;
+    };
+    HashMap<const RenderObject*, IntrinsicSizeAlongMainAxis> m_intrinsicSizeAlongMainAxis;
+    // Children that were already laid out by preferredMainAxisContentExtentForChild during the current layoutFlexItems.
+    HashSet<const RenderObject*> m_relaidOutChildren;
 
     mutable OrderIterator m_orderIterator;
     int m_numberOfInFlowChildrenOnFirstLine;
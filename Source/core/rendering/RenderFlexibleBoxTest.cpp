@@ -0,0 +1,76 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/rendering/RenderFlexibleBox.h"
+
+#include "core/css/CSSPropertyNames.h"
+#include "core/rendering/RenderingTestHelper.h"
+
+namespace blink {
+
+namespace {
+
+class RenderFlexibleBoxTest : public RenderingTest {
+protected:
+    RenderBox* renderBox(const char* id) const
+    {
+        return toRenderBox(document().getElementById(id)->renderer());
+    }
+
+    void setStyle(const char* id, CSSPropertyID property, const String& value)
+    {
+        document().getElementById(id)->setInlineStyleProperty(property, value);
+        document().view()->updateLayoutAndStyleIfNeededRecursive();
+    }
+};
+
+static const char* columnFlexboxHTML =
+    "<div id='flexbox' style='display: flex; flex-direction: column; width: 300px'>"
+    "<div id='item' style='width: 100px'><div id='content' style='height: 50px'></div></div>"
+    "</div>";
+
+TEST_F(RenderFlexibleBoxTest, InvalidatedItemIsMeasuredAgain)
+{
+    setBodyInnerHTML(columnFlexboxHTML);
+    EXPECT_EQ(LayoutUnit(50), renderBox("item")->logicalHeight());
+
+    setStyle("content", CSSPropertyHeight, "80px");
+    EXPECT_EQ(LayoutUnit(80), renderBox("item")->logicalHeight());
+    EXPECT_EQ(LayoutUnit(80), renderBox("flexbox")->logicalHeight());
+}
+
+TEST_F(RenderFlexibleBoxTest, InvalidatedItemIsMeasuredAgainWhenFlexboxWidthChanges)
+{
+    setBodyInnerHTML(columnFlexboxHTML);
+
+    // The item keeps its width, but it needs layout, so its cached size is not used.
+    document().getElementById("content")->setInlineStyleProperty(CSSPropertyHeight, "80px");
+    setStyle("flexbox", CSSPropertyWidth, "400px");
+    EXPECT_EQ(LayoutUnit(100), renderBox("item")->logicalWidth());
+    EXPECT_EQ(LayoutUnit(80), renderBox("flexbox")->logicalHeight());
+}
+
+TEST_F(RenderFlexibleBoxTest, ItemWithChangedWidthIsMeasuredAgain)
+{
+    setBodyInnerHTML(
+        "<div id='flexbox' style='display: flex; flex-direction: column; width: 300px'>"
+        "<div id='item'>"
+        "<div style='display: inline-block; width: 100px; height: 10px'></div>"
+        "<div style='display: inline-block; width: 100px; height: 10px'></div>"
+        "<div style='display: inline-block; width: 100px; height: 10px'></div>"
+        "</div>"
+        "</div>");
+    LayoutUnit oneLineHeight = renderBox("item")->logicalHeight();
+
+    // The item is clean, but it gets a narrower width, so the three boxes wrap.
+    setStyle("flexbox", CSSPropertyWidth, "150px");
+    EXPECT_EQ(LayoutUnit(150), renderBox("item")->logicalWidth());
+    EXPECT_EQ(oneLineHeight * 3, renderBox("item")->logicalHeight());
+    EXPECT_EQ(renderBox("item")->logicalHeight(), renderBox("flexbox")->logicalHeight());
+}
+
+} // namespace
+
+} // namespace blink
@@ -952,18 +952,36 @@ void RenderGrid::placeAutoMajorAxisItemsOnGrid(const Vector<RenderBox*>& autoGri
 {
     std::pair<size_t, size_t> autoPlacementCursor = std::make_pair(0, 0);
     bool isGridAutoFlowDense = style()->isGridAutoFlowAlgorithmDense();
+    size_t firstNonFullMajorAxisTrack = 0;
 
     for (size_t i = 0; i < autoGridItems.size(); ++i) {
         placeAutoMajorAxisItemOnGrid(*autoGridItems[i], autoPlacementCursor);
 
-        // If grid-auto-flow is dense, reset auto-placement cursor.
+        // If grid-auto-flow is dense, reset auto-placement cursor. No item can start in a
+        // track that is already full, so rewind only to the first track with an empty cell
+        // instead of rescanning every occupied cell for each item.
         if (isGridAutoFlowDense) {
-            autoPlacementCursor.first = 0;
-            autoPlacementCursor.second = 0;
+            firstNonFullMajorAxisTrack = firstNonFullTrack(autoPlacementMajorAxisDirection(), firstNonFullMajorAxisTrack);
+            autoPlacementCursor.first = autoPlacementMajorAxisDirection() == ForRows ? firstNonFullMajorAxisTrack : 0;
+            autoPlacementCursor.second = autoPlacementMajorAxisDirection() == ForColumns ? firstNonFullMajorAxisTrack : 0;
         }
     }
 }
 
+size_t RenderGrid::firstNonFullTrack(GridTrackSizingDirection direction, size_t startTrack) const
+{
+    const size_t trackCount = (direction == ForColumns) ? gridColumnCount() : gridRowCount();
+    const size_t crossTrackCount = (direction == ForColumns) ? gridRowCount() : gridColumnCount();
+    for (size_t track = startTrack; track < trackCount; ++track) {
+        for (size_t crossTrack = 0; crossTrack < crossTrackCount; ++crossTrack) {
+            const GridCell& children = (direction == ForColumns) ? m_grid[crossTrack][track] : m_grid[track][crossTrack];
+            if (children.isEmpty())
+                return track;
+        }
+    }
+    return trackCount;
+}
+
 void RenderGrid::placeAutoMajorAxisItemOnGrid(RenderBox& gridItem, std::pair<size_t, size_t>& autoPlacementCursor)
 {
     OwnPtr<GridSpan> minorAxisPositions = GridResolvedPosition::resolveGridPositionsFromStyle(*style(), gridItem, autoPlacementMinorAxisDirection());
@@ -45,8 +45,10 @@
 #include "core/rendering/RenderView.h"
 #include "core/rendering/TextRunConstructor.h"
 #include "core/svg/graphics/SVGImage.h"
+#include "platform/RuntimeEnabledFeatures.h"
 #include "platform/fonts/Font.h"
 #include "platform/fonts/FontCache.h"
+#include "platform/graphics/ImageDecodeScheduler.h"
 
 namespace blink {
 
@@ -397,12 +399,19 @@ void RenderImage::layout()
 
 bool RenderImage::updateImageLoadingPriorities()
 {
-    if (!m_imageResource || !m_imageResource->cachedImage() || m_imageResource->cachedImage()->isLoaded())
+    if (!m_imageResource || !m_imageResource->cachedImage())
+        return false;
+
+    bool isLoaded = m_imageResource->cachedImage()->isLoaded();
+    if (isLoaded && !RuntimeEnabledFeatures::imageDecodeSchedulingEnabled())
         return false;
 
     LayoutRect viewBounds = viewRect();
     LayoutRect objectBounds = absoluteContentBox();
 
+    if (isLoaded)
+        return !scheduleDecodeIfNearViewport(viewBounds, objectBounds);
+
     // The object bounds might be empty right now, so intersects will fail since it doesn't deal
     // with empty rects. Use LayoutRect::contains in that case.
     bool isVisible;
@@ -425,6 +434,21 @@ bool RenderImage::updateImageLoadingPriorities()
     return true;
 }
 
+bool RenderImage::scheduleDecodeIfNearViewport(const LayoutRect& viewBounds, const LayoutRect& objectBounds)
+{
+    LayoutUnit horizontalDistance = std::max<LayoutUnit>(0, std::max(viewBounds.x() - objectBounds.maxX(), objectBounds.x() - viewBounds.maxX()));
+    LayoutUnit verticalDistance = std::max<LayoutUnit>(0, std::max(viewBounds.y() - objectBounds.maxY(), objectBounds.y() - viewBounds.maxY()));
+    float distanceFromViewport = std::max(horizontalDistance, verticalDistance).toFloat();
+    if (horizontalDistance > viewBounds.width() || verticalDistance > viewBounds.height()) {
+        ResourceLoadPriorityOptimizer::resourceLoadPriorityOptimizer()->notifyObjectWaitingForDecode(this, distanceFromViewport);
+        return false;
+    }
+
+    // Images the scheduler can't decode are painted as before, so they are done with too.
+    ImageDecodeScheduler::instance().scheduleDecode(m_imageResource->cachedImage()->image(), distanceFromViewport);
+    return true;
+}
+
 void RenderImage::computeIntrinsicRatioInformation(FloatSize& intrinsicSize, double& intrinsicRatio) const
 {
     RenderReplaced::computeIntrinsicRatioInformation(intrinsicSize, intrinsicRatio);
@@ -109,6 +109,9 @@ private:
     void updateIntrinsicSizeIfNeeded(const LayoutSize&);
     // Update the size of the image to be rendered. Object-fit may cause this to be different from the CSS box's content rect.
     void updateInnerContentRect();
+    // Hands the loaded image to the ImageDecodeScheduler once it is within a viewport of the
+    // visible area. Returns false until then.
+    bool scheduleDecodeIfNearViewport(const LayoutRect& viewBounds, const LayoutRect& objectBounds);
 
     // Text to display as long as the image isn't available.
     String m_altText;
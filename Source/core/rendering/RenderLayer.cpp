@@ -61,6 +61,7 @@
 #include "core/rendering/HitTestRequest.h"
 #include "core/rendering/HitTestResult.h"
 #include "core/rendering/HitTestingTransformState.h"
+#include "core/rendering/LayerDisplayListCache.h"
 #include "core/rendering/RenderFlowThread.h"
 #include "core/rendering/RenderGeometryMap.h"
 #include "core/rendering/RenderInline.h"
@@ -1241,6 +1242,13 @@ void RenderLayer::addChild(RenderLayer* child, RenderLayer* beforeChild)
     dirtyAncestorChainVisibleDescendantStatus();
     dirtyAncestorChainHasSelfPaintingLayerDescendantStatus();
 
+    // The child's renderers may have been painted by the layer that paints us.
+    invalidateDisplayListCacheOfPaintingLayer();
+
+    // Skipped content is only checked for layers when it starts skipping.
+    if (RuntimeEnabledFeatures::cssContentSkippingEnabled())
+        child->renderer()->requestContentLayoutOfSkippedAncestors();
+
     child->updateDescendantDependentFlags();
 }
 
@@ -1275,6 +1283,8 @@ RenderLayer* RenderLayer::removeChild(RenderLayer* oldChild)
 
     dirtyAncestorChainHasSelfPaintingLayerDescendantStatus();
 
+    invalidateDisplayListCacheOfPaintingLayer();
+
     oldChild->updateDescendantDependentFlags();
 
     if (oldChild->m_hasVisibleContent || oldChild->m_hasVisibleDescendant)
@@ -1868,9 +1878,13 @@ void RenderLayer::paintLayerContents(GraphicsContext* context, const LayerPainti
     else if (paintFlags & PaintLayerPaintingRootBackgroundOnly)
         paintBehavior |= PaintBehaviorRootBackgroundOnly;
 
+    LayerDisplayListCache* displayListCache = 0;
+    if (shouldPaintBackground || shouldPaintOwnContents)
+        displayListCache = displayListCacheForPainting(context, localPaintingInfo, paintFlags, layerFragments, offsetFromRoot, paintBehavior, paintingRootForRenderer, selectionOnly);
+
     if (shouldPaintBackground) {
         paintBackgroundForFragments(layerFragments, context, transparencyLayerContext, paintingInfo.paintDirtyRect, haveTransparency,
-            localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+            localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags, displayListCache);
     }
 
     if (shouldPaintNegZOrderList)
@@ -1878,7 +1892,7 @@ void RenderLayer::paintLayerContents(GraphicsContext* context, const LayerPainti
 
     if (shouldPaintOwnContents) {
         paintForegroundForFragments(layerFragments, context, transparencyLayerContext, paintingInfo.paintDirtyRect, haveTransparency,
-            localPaintingInfo, paintBehavior, paintingRootForRenderer, selectionOnly, paintFlags);
+            localPaintingInfo, paintBehavior, paintingRootForRenderer, selectionOnly, paintFlags, displayListCache);
     }
 
     if (shouldPaintOutline)
@@ -2118,9 +2132,78 @@ static inline LayoutSize subPixelAccumulationIfNeeded(const LayoutSize& subPixel
     return subPixelAccumulation;
 }
 
+// Layers whose recordings would cover more pixels than this aren't cached.
+static const int maxDisplayListCacheArea = 2048 * 2048;
+
+LayerDisplayListCache* RenderLayer::displayListCacheForPainting(GraphicsContext* context, const LayerPaintingInfo& localPaintingInfo, PaintLayerFlags paintFlags,
+    const LayerFragments& layerFragments, const LayoutPoint& offsetFromRoot, PaintBehavior paintBehavior, RenderObject* paintingRootForRenderer, bool selectionOnly)
+{
+    if (!RuntimeEnabledFeatures::layerDisplayListCachingEnabled())
+        return 0;
+
+    // The root background paints into the whole damage rect, and filters may change the
+    // damage rect and the clipping.
+    if (renderer()->isRenderView() || renderer()->isDocumentElement() || paintsWithFilters())
+        return 0;
+    if (context->contextDisabled() || context->printing())
+        return 0;
+    if (selectionOnly || paintingRootForRenderer || paintBehavior != PaintBehaviorNormal || localPaintingInfo.paintBehavior != PaintBehaviorNormal)
+        return 0;
+    if (paintFlags & (PaintLayerUncachedClipRects | PaintLayerPaintingReflection))
+        return 0;
+    if (!localPaintingInfo.clipToDirtyRect || layerFragments.size() != 1)
+        return 0;
+
+    LayerDisplayListCache::Key key;
+    key.rootLayer = localPaintingInfo.rootLayer;
+    key.paintFlags = paintFlags & (PaintLayerPaintingCompositingScrollingPhase | PaintLayerPaintingOverflowContents);
+    key.deviceScaleFactor = context->deviceScaleFactor();
+    AffineTransform ctm = context->getCTM();
+    key.scale = FloatSize(ctm.xScale(), ctm.yScale());
+    key.subPixelAccumulation = localPaintingInfo.subPixelAccumulation;
+
+    // Compute the fragment without the damage rect, so that the recordings can be replayed for any damage rect.
+    ClipRectsContext clipRectsContext(localPaintingInfo.rootLayer, PaintingClipRects, IgnoreOverlayScrollbarSize, localPaintingInfo.subPixelAccumulation);
+    if (shouldRespectOverflowClip(paintFlags, renderer()) == IgnoreOverflowClip)
+        clipRectsContext.setIgnoreOverflowClip();
+    clipper().calculateRects(clipRectsContext, PaintInfo::infiniteRect(), key.fragment.layerBounds, key.fragment.backgroundRect,
+        key.fragment.foregroundRect, key.fragment.outlineRect, &offsetFromRoot);
+    key.fragment.shouldPaintContent = true;
+
+    // The layer bounds don't include overflow.
+    LayoutRect recordingBounds = physicalBoundingBox(localPaintingInfo.rootLayer, &offsetFromRoot);
+    recordingBounds.inflate(renderer()->style()->outlineSize());
+    recordingBounds.intersect(key.fragment.backgroundRect.rect());
+    IntRect pixelRecordingBounds = enclosingIntRect(recordingBounds);
+    if (pixelRecordingBounds.isEmpty() || pixelRecordingBounds.width() > maxDisplayListCacheArea / pixelRecordingBounds.height()) {
+        m_displayListCache.clear();
+        return 0;
+    }
+
+    if (!m_displayListCache)
+        m_displayListCache = LayerDisplayListCache::create();
+    m_displayListCache->setKey(key);
+    m_displayListCache->setRecordingBounds(pixelRecordingBounds);
+    if (!m_displayListCache->canRecord())
+        return 0;
+    return m_displayListCache.get();
+}
+
+void RenderLayer::invalidateDisplayListCacheOfPaintingLayer()
+{
+    // Renderers of layers that don't paint themselves are painted by the nearest self-painting ancestor.
+    for (RenderLayer* layer = this; layer; layer = layer->parent()) {
+        if (layer->isSelfPaintingLayer()) {
+            if (layer->m_displayListCache)
+                layer->m_displayListCache->clear();
+            return;
+        }
+    }
+}
+
 void RenderLayer::paintBackgroundForFragments(const LayerFragments& layerFragments, GraphicsContext* context, GraphicsContext* transparencyLayerContext,
     const LayoutRect& transparencyPaintDirtyRect, bool haveTransparency, const LayerPaintingInfo& localPaintingInfo, PaintBehavior paintBehavior,
-    RenderObject* paintingRootForRenderer, PaintLayerFlags paintFlags)
+    RenderObject* paintingRootForRenderer, PaintLayerFlags paintFlags, LayerDisplayListCache* displayListCache)
 {
     for (size_t i = 0; i < layerFragments.size(); ++i) {
         const LayerFragment& fragment = layerFragments.at(i);
@@ -2138,9 +2221,20 @@ void RenderLayer::paintBackgroundForFragments(const LayerFragments& layerFragmen
         }
 
         // Paint the background.
-        // FIXME: Eventually we will collect the region from the fragment itself instead of just from the paint info.
-        PaintInfo paintInfo(context, pixelSnappedIntRect(fragment.backgroundRect.rect()), PaintPhaseBlockBackground, paintBehavior, paintingRootForRenderer, 0, localPaintingInfo.rootLayer->renderer());
-        renderer()->paint(paintInfo, toPoint(fragment.layerBounds.location() - renderBoxLocation() + subPixelAccumulationIfNeeded(localPaintingInfo.subPixelAccumulation, compositingState())));
+        if (displayListCache) {
+            if (!displayListCache->displayList(LayerDisplayListCache::BackgroundPhase)) {
+                const LayerFragment& recordingFragment = displayListCache->key().fragment;
+                context->beginRecording(displayListCache->recordingBounds());
+                PaintInfo paintInfo(context, pixelSnappedIntRect(recordingFragment.backgroundRect.rect()), PaintPhaseBlockBackground, paintBehavior, paintingRootForRenderer, 0, localPaintingInfo.rootLayer->renderer());
+                renderer()->paint(paintInfo, toPoint(recordingFragment.layerBounds.location() - renderBoxLocation() + subPixelAccumulationIfNeeded(localPaintingInfo.subPixelAccumulation, compositingState())));
+                displayListCache->setDisplayList(LayerDisplayListCache::BackgroundPhase, context->endRecording());
+            }
+            context->drawDisplayList(displayListCache->displayList(LayerDisplayListCache::BackgroundPhase));
+        } else {
+            // FIXME: Eventually we will collect the region from the fragment itself instead of just from the paint info.
+            PaintInfo paintInfo(context, pixelSnappedIntRect(fragment.backgroundRect.rect()), PaintPhaseBlockBackground, paintBehavior, paintingRootForRenderer, 0, localPaintingInfo.rootLayer->renderer());
+            renderer()->paint(paintInfo, toPoint(fragment.layerBounds.location() - renderBoxLocation() + subPixelAccumulationIfNeeded(localPaintingInfo.subPixelAccumulation, compositingState())));
+        }
 
         if (localPaintingInfo.clipToDirtyRect)
             restoreClip(context, localPaintingInfo.paintDirtyRect, fragment.backgroundRect);
@@ -2149,7 +2243,7 @@ void RenderLayer::paintBackgroundForFragments(const LayerFragments& layerFragmen
 
 void RenderLayer::paintForegroundForFragments(const LayerFragments& layerFragments, GraphicsContext* context, GraphicsContext* transparencyLayerContext,
     const LayoutRect& transparencyPaintDirtyRect, bool haveTransparency, const LayerPaintingInfo& localPaintingInfo, PaintBehavior paintBehavior,
-    RenderObject* paintingRootForRenderer, bool selectionOnly, PaintLayerFlags paintFlags)
+    RenderObject* paintingRootForRenderer, bool selectionOnly, PaintLayerFlags paintFlags, LayerDisplayListCache* displayListCache)
 {
     // Begin transparency if we have something to paint.
     if (haveTransparency || paintsWithBlendMode()) {
@@ -2167,15 +2261,33 @@ void RenderLayer::paintForegroundForFragments(const LayerFragments& layerFragmen
     if (shouldClip)
         clipToRect(localPaintingInfo, context, layerFragments[0].foregroundRect, paintFlags);
 
-    // We have to loop through every fragment multiple times, since we have to issue paint invalidations in each specific phase in order for
-    // interleaving of the fragments to work properly.
-    paintForegroundForFragmentsWithPhase(selectionOnly ? PaintPhaseSelection : PaintPhaseChildBlockBackgrounds, layerFragments,
-        context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
-
-    if (!selectionOnly) {
-        paintForegroundForFragmentsWithPhase(PaintPhaseFloat, layerFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
-        paintForegroundForFragmentsWithPhase(PaintPhaseForeground, layerFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
-        paintForegroundForFragmentsWithPhase(PaintPhaseChildOutlines, layerFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+    if (displayListCache) {
+        ASSERT(!selectionOnly);
+        // Match paintForegroundForFragmentsWithPhase(), which doesn't paint anything for such fragments.
+        if (layerFragments[0].shouldPaintContent && !layerFragments[0].foregroundRect.isEmpty()) {
+            if (!displayListCache->displayList(LayerDisplayListCache::ForegroundPhase)) {
+                LayerFragments recordingFragments;
+                recordingFragments.append(displayListCache->key().fragment);
+                context->beginRecording(displayListCache->recordingBounds());
+                paintForegroundForFragmentsWithPhase(PaintPhaseChildBlockBackgrounds, recordingFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+                paintForegroundForFragmentsWithPhase(PaintPhaseFloat, recordingFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+                paintForegroundForFragmentsWithPhase(PaintPhaseForeground, recordingFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+                paintForegroundForFragmentsWithPhase(PaintPhaseChildOutlines, recordingFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+                displayListCache->setDisplayList(LayerDisplayListCache::ForegroundPhase, context->endRecording());
+            }
+            context->drawDisplayList(displayListCache->displayList(LayerDisplayListCache::ForegroundPhase));
+        }
+    } else {
+        // We have to loop through every fragment multiple times, since we have to issue paint invalidations in each specific phase in order for
+        // interleaving of the fragments to work properly.
+        paintForegroundForFragmentsWithPhase(selectionOnly ? PaintPhaseSelection : PaintPhaseChildBlockBackgrounds, layerFragments,
+            context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+
+        if (!selectionOnly) {
+            paintForegroundForFragmentsWithPhase(PaintPhaseFloat, layerFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+            paintForegroundForFragmentsWithPhase(PaintPhaseForeground, layerFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+            paintForegroundForFragmentsWithPhase(PaintPhaseChildOutlines, layerFragments, context, localPaintingInfo, paintBehavior, paintingRootForRenderer, paintFlags);
+        }
     }
 
     if (shouldClip)
@@ -3403,9 +3515,13 @@ void RenderLayer::updateSelfPaintingLayer()
         return;
 
     m_isSelfPaintingLayer = isSelfPaintingLayer;
+    m_displayListCache.clear();
 
-    if (parent())
+    if (parent()) {
         parent()->dirtyAncestorChainHasSelfPaintingLayerDescendantStatus();
+        // Our renderers move between our painting and the painting of an ancestor.
+        parent()->invalidateDisplayListCacheOfPaintingLayer();
+    }
 }
 
 bool RenderLayer::hasNonEmptyChildRenderers() const
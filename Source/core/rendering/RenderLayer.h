@@ -65,6 +65,7 @@ class FilterOperations;
 class HitTestRequest;
 class HitTestResult;
 class HitTestingTransformState;
+class LayerDisplayListCache;
 class CompositedLayerMapping;
 class RenderLayerCompositor;
 class RenderStyle;
@@ -523,6 +524,10 @@ public:
 
     void setShouldDoFullPaintInvalidationIncludingNonCompositingDescendants();
 
+    // Drops the display lists cached by the self-painting layer that paints this layer's renderers.
+    void invalidateDisplayListCacheOfPaintingLayer();
+    LayerDisplayListCache* displayListCacheForTesting() const { return m_displayListCache.get(); }
+
 private:
     // Bounding box in the coordinates of this layer.
     LayoutRect logicalBoundingBox() const;
@@ -570,11 +575,14 @@ private:
         ShouldRespectOverflowClip = RespectOverflowClip, const LayoutPoint* offsetFromRoot = 0,
         const LayoutSize& subPixelAccumulation = LayoutSize(), const LayoutRect* layerBoundingBox = 0);
     void updatePaintingInfoForFragments(LayerFragments&, const LayerPaintingInfo&, PaintLayerFlags, bool shouldPaintContent, const LayoutPoint* offsetFromRoot);
+    LayerDisplayListCache* displayListCacheForPainting(GraphicsContext*, const LayerPaintingInfo&, PaintLayerFlags, const LayerFragments&,
+        const LayoutPoint& offsetFromRoot, PaintBehavior, RenderObject* paintingRootForRenderer, bool selectionOnly);
     void paintBackgroundForFragments(const LayerFragments&, GraphicsContext*, GraphicsContext* transparencyLayerContext,
-        const LayoutRect& transparencyPaintDirtyRect, bool haveTransparency, const LayerPaintingInfo&, PaintBehavior, RenderObject* paintingRootForRenderer, PaintLayerFlags);
+        const LayoutRect& transparencyPaintDirtyRect, bool haveTransparency, const LayerPaintingInfo&, PaintBehavior, RenderObject* paintingRootForRenderer, PaintLayerFlags,
+        LayerDisplayListCache*);
     void paintForegroundForFragments(const LayerFragments&, GraphicsContext*, GraphicsContext* transparencyLayerContext,
         const LayoutRect& transparencyPaintDirtyRect, bool haveTransparency, const LayerPaintingInfo&, PaintBehavior, RenderObject* paintingRootForRenderer,
-        bool selectionOnly, PaintLayerFlags);
+        bool selectionOnly, PaintLayerFlags, LayerDisplayListCache*);
     void paintForegroundForFragmentsWithPhase(PaintPhase, const LayerFragments&, GraphicsContext*, const LayerPaintingInfo&, PaintBehavior, RenderObject* paintingRootForRenderer, PaintLayerFlags);
     void paintOutlineForFragments(const LayerFragments&, GraphicsContext*, const LayerPaintingInfo&, PaintBehavior, RenderObject* paintingRootForRenderer, PaintLayerFlags);
     void paintOverflowControlsForFragments(const LayerFragments&, GraphicsContext*, const LayerPaintingInfo&, PaintLayerFlags);
@@ -734,6 +742,7 @@ private:
     RenderLayerClipper m_clipper; // FIXME: Lazily allocate?
     OwnPtr<RenderLayerStackingNode> m_stackingNode;
     OwnPtrWillBePersistent<RenderLayerReflectionInfo> m_reflectionInfo;
+    OwnPtr<LayerDisplayListCache> m_displayListCache;
 
     LayoutSize m_subpixelAccumulation; // The accumulated subpixel offset of a composited layer's composited bounds compared to absolute coordinates.
 };
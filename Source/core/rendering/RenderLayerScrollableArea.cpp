@@ -352,6 +352,7 @@ void RenderLayerScrollableArea::setScrollOffset(const IntPoint& newScrollOffset)
     if (scrollOffset() == toIntSize(newScrollOffset))
         return;
 
+    IntSize scrollDelta = toIntSize(newScrollOffset) - scrollOffset();
     setScrollOffset(toIntSize(newScrollOffset));
 
     LocalFrame* frame = box().frame();
@@ -374,6 +375,8 @@ void RenderLayerScrollableArea::setScrollOffset(const IntPoint& newScrollOffset)
         // Update regions, scrolling may change the clip of a particular region.
         frameView->updateAnnotatedRegions();
         frameView->setNeedsUpdateWidgetPositions();
+        // Skipped content inside this scroller may have been scrolled into view.
+        frameView->scheduleLayoutOfSkippedContentAfterScroll(scrollDelta);
         updateCompositingLayersAfterScroll();
     }
 
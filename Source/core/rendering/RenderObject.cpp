@@ -54,6 +54,7 @@
 #include "core/paint/ObjectPainter.h"
 #include "core/rendering/FlowThreadController.h"
 #include "core/rendering/HitTestResult.h"
+#include "core/rendering/RenderBlockFlow.h"
 #include "core/rendering/RenderCounter.h"
 #include "core/rendering/RenderDeprecatedFlexibleBox.h"
 #include "core/rendering/RenderFlexibleBox.h"
@@ -706,6 +707,10 @@ void RenderObject::markContainingBlocksForLayout(bool scheduleRelayout, RenderOb
         if (object->selfNeedsLayout())
             return;
 
+        // The descendants of a skipped block are laid out when it comes near the viewport.
+        if (object->isSkippingContentLayout() && !layouter)
+            return;
+
         // Don't mark the outermost object of an unrooted subtree. That object will be
         // marked when the subtree is added to the document.
         RenderObject* container = object->container();
@@ -745,8 +750,11 @@ void RenderObject::markContainingBlocksForLayout(bool scheduleRelayout, RenderOb
             return;
 
         last = object;
-        if (scheduleRelayout && objectIsRelayoutBoundary(last))
-            break;
+        if (scheduleRelayout && objectIsRelayoutBoundary(last)) {
+            // A relayout boundary inside skipped content is marked up to the skipped block instead.
+            if (!RuntimeEnabledFeatures::cssContentSkippingEnabled() || !last->isInsideSkippedContent())
+                break;
+        }
         object = container;
     }
 
@@ -754,6 +762,25 @@ void RenderObject::markContainingBlocksForLayout(bool scheduleRelayout, RenderOb
         last->scheduleRelayout();
 }
 
+bool RenderObject::isInsideSkippedContent() const
+{
+    for (const RenderObject* ancestor = container(); ancestor; ancestor = ancestor->container()) {
+        if (ancestor->isSkippingContentLayout())
+            return true;
+    }
+    return false;
+}
+
+void RenderObject::requestContentLayoutOfSkippedAncestors()
+{
+    // Skipped blocks can be nested if the inner one was skipped before the outer one, so all of
+    // them have to lay out their content again.
+    for (RenderObject* ancestor = container(); ancestor; ancestor = ancestor->container()) {
+        if (ancestor->isSkippingContentLayout())
+            toRenderBlockFlow(ancestor)->requestContentLayout();
+    }
+}
+
 #if ENABLE(ASSERT)
 void RenderObject::checkBlockPositionedObjectsNeedLayout()
 {
@@ -1191,6 +1218,11 @@ void RenderObject::invalidatePaintUsingContainer(const RenderLayerModelObject* p
         "object", this->debugName().ascii(),
         "info", jsonObjectForPaintInvalidationInfo(r, invalidationReasonToString(invalidationReason)));
 
+    if (RuntimeEnabledFeatures::layerDisplayListCachingEnabled()) {
+        if (RenderLayer* layer = enclosingLayer())
+            layer->invalidateDisplayListCacheOfPaintingLayer();
+    }
+
     if (paintInvalidationContainer->isRenderFlowThread()) {
         toRenderFlowThread(paintInvalidationContainer)->paintInvalidationRectangleInRegions(r);
         return;
@@ -1834,6 +1866,16 @@ void RenderObject::styleWillChange(StyleDifference diff, const RenderStyle& newS
             if (newStyleSlowScroll)
                 view()->frameView()->addSlowRepaintObject();
         }
+
+        if (RuntimeEnabledFeatures::layerDisplayListCachingEnabled()) {
+            bool hadFixedBackgroundImage = m_style && m_style->hasFixedBackgroundImage();
+            if (hadFixedBackgroundImage != newStyle.hasFixedBackgroundImage()) {
+                if (hadFixedBackgroundImage)
+                    view()->frameView()->removeFixedBackgroundObject(this);
+                else
+                    view()->frameView()->addFixedBackgroundObject(this);
+            }
+        }
     }
 
     // Elements with non-auto touch-action will send a SetTouchAction message
@@ -2386,6 +2428,14 @@ void RenderObject::willBeDestroyed()
     if (!documentBeingDestroyed() && node() && !node()->isTextNode() && m_style && m_style->touchAction() != TouchActionAuto)
         document().frameHost()->eventHandlerRegistry().didRemoveEventHandler(*node(), EventHandlerRegistry::TouchEvent);
 
+    // Don't use view() because the document's renderView has been set to 0 during destruction.
+    if (m_style && m_style->hasFixedBackgroundImage()) {
+        if (LocalFrame* frame = this->frame()) {
+            if (FrameView* frameView = frame->view())
+                frameView->removeFixedBackgroundObject(this);
+        }
+    }
+
     setAncestorLineBoxDirty(false);
 
     clearLayoutRootIfNeeded();
@@ -3089,7 +3139,7 @@ bool RenderObject::nodeAtFloatPoint(const HitTestRequest&, HitTestResult&, const
     return false;
 }
 
-bool RenderObject::isRelayoutBoundaryForInspector() const
+bool RenderObject::isRelayoutBoundary() const
 {
     return objectIsRelayoutBoundary(this);
 }
@@ -242,7 +242,8 @@ public:
 
     void assertSubtreeIsLaidOut() const
     {
-        for (const RenderObject* renderer = this; renderer; renderer = renderer->nextInPreOrder())
+        // The descendants of a block that skipped laying out its content are allowed to stay dirty.
+        for (const RenderObject* renderer = this; renderer; renderer = renderer->isSkippingContentLayout() ? renderer->nextInPreOrderAfterChildren() : renderer->nextInPreOrder())
             renderer->assertRendererLaidOut();
     }
 
@@ -425,6 +426,12 @@ public:
     void setChildrenInline(bool b) { m_bitfields.setChildrenInline(b); }
     bool hasColumns() const { return m_bitfields.hasColumns(); }
     void setHasColumns(bool b = true) { m_bitfields.setHasColumns(b); }
+    // True if this block was laid out without its descendants because it was far from the viewport.
+    // See RenderBlockFlow::shouldSkipContentLayout().
+    bool isSkippingContentLayout() const { return m_bitfields.isSkippingContentLayout(); }
+    bool isInsideSkippedContent() const;
+    // Called when this object gets a layer, which can only be positioned by laying out the skipped content.
+    void requestContentLayoutOfSkippedAncestors();
 
     bool alwaysCreateLineBoxesForRenderInline() const
     {
@@ -1005,7 +1012,7 @@ public:
 
     RespectImageOrientationEnum shouldRespectImageOrientation() const;
 
-    bool isRelayoutBoundaryForInspector() const;
+    bool isRelayoutBoundary() const;
 
     // The previous paint invalidation rect in the object's previous paint backing.
     const LayoutRect& previousPaintInvalidationRect() const { return m_previousPaintInvalidationRect; }
@@ -1232,6 +1239,7 @@ private:
             , m_hasPendingResourceUpdate(false)
             , m_childrenInline(false)
             , m_hasColumns(false)
+            , m_isSkippingContentLayout(false)
             , m_alwaysCreateLineBoxesForRenderInline(false)
             , m_positionedState(IsStaticallyPositioned)
             , m_selectionState(SelectionNone)
@@ -1240,7 +1248,7 @@ private:
         {
         }
 
-        // 32 bits have been used in the first word, and 11 in the second.
+        // 32 bits have been used in the first word, and 12 in the second.
         ADD_BOOLEAN_BITFIELD(selfNeedsLayout, SelfNeedsLayout);
         ADD_BOOLEAN_BITFIELD(shouldDoFullPaintInvalidation, ShouldDoFullPaintInvalidation);
         ADD_BOOLEAN_BITFIELD(shouldInvalidateOverflowForPaint, ShouldInvalidateOverflowForPaint);
@@ -1281,6 +1289,7 @@ private:
         // from RenderBlock
         ADD_BOOLEAN_BITFIELD(childrenInline, ChildrenInline);
         ADD_BOOLEAN_BITFIELD(hasColumns, HasColumns);
+        ADD_BOOLEAN_BITFIELD(isSkippingContentLayout, IsSkippingContentLayout);
 
         // from RenderInline
         ADD_BOOLEAN_BITFIELD(alwaysCreateLineBoxesForRenderInline, AlwaysCreateLineBoxesForRenderInline);
@@ -1324,6 +1333,7 @@ private:
     void setNeedsSimplifiedNormalFlowLayout(bool b) { m_bitfields.setNeedsSimplifiedNormalFlowLayout(b); }
     void setIsDragging(bool b) { m_bitfields.setIsDragging(b); }
     void setEverHadLayout(bool b) { m_bitfields.setEverHadLayout(b); }
+    void setIsSkippingContentLayout(bool b) { m_bitfields.setIsSkippingContentLayout(b); }
     void setShouldInvalidateOverflowForPaint(bool b) { m_bitfields.setShouldInvalidateOverflowForPaint(b); }
     void setSelfNeedsOverflowRecalcAfterStyleChange(bool b) { m_bitfields.setSelfNeedsOverflowRecalcAfterStyleChange(b); }
     void setChildNeedsOverflowRecalcAfterStyleChange(bool b) { m_bitfields.setChildNeedsOverflowRecalcAfterStyleChange(b); }
@@ -47,8 +47,10 @@ SubtreeLayoutScope::~SubtreeLayoutScope()
     RELEASE_ASSERT(!m_root.needsLayout());
 
 #if ENABLE(ASSERT)
-    for (HashSet<RenderObject*>::iterator it = m_renderersToLayout.begin(); it != m_renderersToLayout.end(); ++it)
-        (*it)->assertRendererLaidOut();
+    for (HashSet<RenderObject*>::iterator it = m_renderersToLayout.begin(); it != m_renderersToLayout.end(); ++it) {
+        if (!(*it)->isInsideSkippedContent())
+            (*it)->assertRendererLaidOut();
+    }
 #endif
 }
 
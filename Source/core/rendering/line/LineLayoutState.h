@@ -37,11 +37,13 @@ public:
         : m_lastFloat(0)
         , m_endLine(0)
         , m_floatIndex(0)
+        , m_layoutLineCount(0)
         , m_endLineLogicalTop(0)
         , m_endLineMatched(false)
         , m_checkForFloatsFromLastLine(false)
         , m_hasInlineChild(false)
         , m_isFullLayout(fullLayout)
+        , m_floatListChanged(false)
         , m_paintInvalidationLogicalTop(paintInvalidationLogicalTop)
         , m_paintInvalidationLogicalBottom(paintInvalidationLogicalBottom)
         , m_adjustedLogicalLineTop(0)
@@ -52,6 +54,11 @@ public:
     void markForFullLayout() { m_isFullLayout = true; }
     bool isFullLayout() const { return m_isFullLayout; }
 
+    // Set when a clean line's floats no longer match the float list. The lines from
+    // that float on are laid out again, and none of the clean lines after it are reused.
+    void markFloatListChanged() { m_floatListChanged = true; }
+    bool floatListChanged() const { return m_floatListChanged; }
+
     bool usesPaintInvalidationBounds() const { return m_usesPaintInvalidationBounds; }
 
     void setPaintInvalidationRange(LayoutUnit logicalHeight)
@@ -93,6 +100,16 @@ public:
     unsigned floatIndex() const { return m_floatIndex; }
     void setFloatIndex(unsigned floatIndex) { m_floatIndex = floatIndex; }
 
+    // Number of root line boxes built by this pass. Every other line of the
+    // block was reused from the previous layout.
+    unsigned layoutLineCount() const { return m_layoutLineCount; }
+    void incrementLayoutLineCount() { ++m_layoutLineCount; }
+    void decrementLayoutLineCount()
+    {
+        ASSERT(m_layoutLineCount);
+        --m_layoutLineCount;
+    }
+
     LayoutUnit adjustedLogicalLineTop() const { return m_adjustedLogicalLineTop; }
     void setAdjustedLogicalLineTop(LayoutUnit value) { m_adjustedLogicalLineTop = value; }
 
@@ -105,6 +122,7 @@ private:
     RootInlineBox* m_endLine;
     LineInfo m_lineInfo;
     unsigned m_floatIndex;
+    unsigned m_layoutLineCount;
     LayoutUnit m_endLineLogicalTop;
     bool m_endLineMatched;
     bool m_checkForFloatsFromLastLine;
@@ -113,6 +131,7 @@ private:
     bool m_hasInlineChild;
 
     bool m_isFullLayout;
+    bool m_floatListChanged;
 
     // FIXME: Should this be a range object instead of two ints?
     LayoutUnit& m_paintInvalidationLogicalTop;
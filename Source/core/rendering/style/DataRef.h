@@ -24,10 +24,65 @@
 #ifndef DataRef_h
 #define DataRef_h
 
+#include "wtf/PassRefPtr.h"
 #include "wtf/RefPtr.h"
+#include "wtf/Vector.h"
 
 namespace blink {
 
+// Remembers the most recently seen data objects of one type so that equal
+// objects computed independently can be replaced by a single shared one.
+template <typename T> class DataInterner {
+public:
+    DataInterner()
+        : m_lookups(0)
+        , m_hits(0)
+        , m_freedCount(0)
+    {
+    }
+
+    // Returns a previously interned object equal to |data|, or interns |data|.
+    PassRefPtr<T> intern(PassRefPtr<T> data)
+    {
+        ++m_lookups;
+        for (size_t i = m_recent.size(); i; --i) {
+            if (m_recent[i - 1].get() == data.get())
+                return data;
+            if (*m_recent[i - 1] == *data) {
+                RefPtr<T> shared = m_recent[i - 1];
+                m_recent.remove(i - 1);
+                m_recent.append(shared);
+                ++m_hits;
+                // Only memory that goes away when |data| is released is saved.
+                if (data->hasOneRef())
+                    ++m_freedCount;
+                return shared.release();
+            }
+        }
+        if (m_recent.size() == capacity)
+            m_recent.remove(0);
+        m_recent.append(data);
+        return m_recent.last();
+    }
+
+    void clear() { m_recent.clear(); }
+
+    unsigned lookups() const { return m_lookups; }
+    unsigned hits() const { return m_hits; }
+    unsigned freedCount() const { return m_freedCount; }
+    size_t bytesFreed() const { return m_freedCount * sizeof(T); }
+
+private:
+    // Comparing data groups is not free, so only look at a few recent ones.
+    // Runs of similar elements are where equal groups show up.
+    static const size_t capacity = 4;
+
+    Vector<RefPtr<T>, capacity> m_recent;
+    unsigned m_lookups;
+    unsigned m_hits;
+    unsigned m_freedCount;
+};
+
 template <typename T> class DataRef {
 public:
     const T* get() const { return m_data.get(); }
@@ -48,6 +103,16 @@ public:
         m_data = T::create();
     }
 
+    // Shares the data with an equal object from |interner| if this is the only
+    // reference to it, i.e. access() copied it for this style and nothing has
+    // shared the copy since. Data still shared with the style it was inherited
+    // or copied from, or already interned, is left alone.
+    void intern(DataInterner<T>& interner)
+    {
+        if (m_data->hasOneRef())
+            m_data = interner.intern(m_data.release());
+    }
+
     bool operator==(const DataRef<T>& o) const
     {
         ASSERT(m_data);
@@ -41,6 +41,7 @@
 #include "platform/fonts/FontSelector.h"
 #include "platform/geometry/FloatRoundedRect.h"
 #include "wtf/MathExtras.h"
+#include "wtf/text/StringBuilder.h"
 
 namespace blink {
 
@@ -329,6 +330,51 @@ bool RenderStyle::inheritedNotEqual(const RenderStyle* other) const
            || rareInheritedData != other->rareInheritedData;
 }
 
+void RenderStyle::internData(StyleDataInterners& interners)
+{
+    m_box.intern(interners.box);
+    visual.intern(interners.visual);
+    m_background.intern(interners.background);
+    surround.intern(interners.surround);
+    rareNonInheritedData.intern(interners.rareNonInherited);
+    rareInheritedData.intern(interners.rareInherited);
+    inherited.intern(interners.inherited);
+    m_svgStyle.intern(interners.svg);
+}
+
+void StyleDataInterners::clear()
+{
+    box.clear();
+    visual.clear();
+    background.clear();
+    surround.clear();
+    rareNonInherited.clear();
+    rareInherited.clear();
+    inherited.clear();
+    svg.clear();
+}
+
+template <typename T>
+static void appendInternerReport(StringBuilder& output, const char* name, const DataInterner<T>& interner)
+{
+    output.append(String::format("  %s: %u of %u copied groups shared, %u freed, %zu bytes freed.\n", name, interner.hits(), interner.lookups(), interner.freedCount(), interner.bytesFreed()));
+}
+
+String StyleDataInterners::report() const
+{
+    StringBuilder output;
+    output.appendLiteral("Style data interning:\n");
+    appendInternerReport(output, "StyleBoxData", box);
+    appendInternerReport(output, "StyleVisualData", visual);
+    appendInternerReport(output, "StyleBackgroundData", background);
+    appendInternerReport(output, "StyleSurroundData", surround);
+    appendInternerReport(output, "StyleRareNonInheritedData", rareNonInherited);
+    appendInternerReport(output, "StyleRareInheritedData", rareInherited);
+    appendInternerReport(output, "StyleInheritedData", inherited);
+    appendInternerReport(output, "SVGRenderStyle", svg);
+    return output.toString();
+}
+
 bool RenderStyle::inheritedDataShared(const RenderStyle* other) const
 {
     // This is a fast check that only looks if the data structures are shared.
@@ -435,6 +481,7 @@ bool RenderStyle::diffNeedsFullLayoutAndPaintInvalidation(const RenderStyle& oth
             || rareNonInheritedData->m_wrapFlow != other.rareNonInheritedData->m_wrapFlow
             || rareNonInheritedData->m_wrapThrough != other.rareNonInheritedData->m_wrapThrough
             || rareNonInheritedData->m_shapeMargin != other.rareNonInheritedData->m_shapeMargin
+            || rareNonInheritedData->m_contentSkipping != other.rareNonInheritedData->m_contentSkipping
             || rareNonInheritedData->m_order != other.rareNonInheritedData->m_order
             || rareNonInheritedData->m_justifyContent != other.rareNonInheritedData->m_justifyContent
             || rareNonInheritedData->m_grid.get() != other.rareNonInheritedData->m_grid.get()
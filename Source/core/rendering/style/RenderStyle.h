@@ -114,6 +114,23 @@ class ContentData;
 
 typedef Vector<RefPtr<RenderStyle>, 4> PseudoStyleCache;
 
+// Used by RenderStyle::internData() to share equal data groups between
+// styles that were resolved independently.
+class StyleDataInterners {
+public:
+    void clear();
+    String report() const;
+
+    DataInterner<StyleBoxData> box;
+    DataInterner<StyleVisualData> visual;
+    DataInterner<StyleBackgroundData> background;
+    DataInterner<StyleSurroundData> surround;
+    DataInterner<StyleRareNonInheritedData> rareNonInherited;
+    DataInterner<StyleRareInheritedData> rareInherited;
+    DataInterner<StyleInheritedData> inherited;
+    DataInterner<SVGRenderStyle> svg;
+};
+
 class RenderStyle: public RefCounted<RenderStyle> {
     friend class AnimatedStyleBuilder; // Used by Web Animations CSS. Sets the color styles
     friend class CSSAnimatableValueFactory; // Used by Web Animations CSS. Gets visited and unvisited colors separately.
@@ -354,6 +371,10 @@ public:
     void inheritFrom(const RenderStyle* inheritParent, IsAtShadowBoundary = NotAtShadowBoundary);
     void copyNonInheritedFrom(const RenderStyle*);
 
+    // Replaces data groups that were copied for this style with equal groups
+    // seen earlier, so that identical groups are shared across elements.
+    void internData(StyleDataInterners&);
+
     PseudoId styleType() const { return static_cast<PseudoId>(noninherited_flags.styleType); }
     void setStyleType(PseudoId styleType) { noninherited_flags.styleType = styleType; }
 
@@ -1467,6 +1488,12 @@ public:
 
     static ClipPathOperation* initialClipPath() { return 0; }
 
+    // A length means that layout of the subtree may be skipped while it is far from the viewport,
+    // with the length used as the content height until it has been laid out once.
+    const Length& contentSkipping() const { return rareNonInheritedData->m_contentSkipping; }
+    void setContentSkipping(const Length& contentSkipping) { SET_VAR(rareNonInheritedData, m_contentSkipping, contentSkipping); }
+    static Length initialContentSkipping() { return Length(MaxSizeNone); }
+
     const Length& shapeMargin() const { return rareNonInheritedData->m_shapeMargin; }
     void setShapeMargin(const Length& shapeMargin) { SET_VAR(rareNonInheritedData, m_shapeMargin, shapeMargin); }
     static Length initialShapeMargin() { return Length(0, Fixed); }
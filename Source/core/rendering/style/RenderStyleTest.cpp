@@ -0,0 +1,87 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "core/rendering/style/RenderStyle.h"
+
+#include <gtest/gtest.h>
+
+using namespace blink;
+
+namespace {
+
+static PassRefPtr<RenderStyle> createStyleWithColor(const Color& color)
+{
+    RefPtr<RenderStyle> style = RenderStyle::create();
+    style->setColor(color);
+    return style.release();
+}
+
+TEST(RenderStyleTest, InternDataSharesEqualCopiedGroups)
+{
+    StyleDataInterners interners;
+    RefPtr<RenderStyle> first = createStyleWithColor(Color(0, 128, 0));
+    RefPtr<RenderStyle> second = createStyleWithColor(Color(0, 128, 0));
+    EXPECT_FALSE(first->inheritedDataShared(second.get()));
+
+    first->internData(interners);
+    second->internData(interners);
+    EXPECT_TRUE(first->inheritedDataShared(second.get()));
+    EXPECT_EQ(2u, interners.inherited.lookups());
+    EXPECT_EQ(1u, interners.inherited.hits());
+    EXPECT_EQ(1u, interners.inherited.freedCount());
+    EXPECT_EQ(sizeof(StyleInheritedData), interners.inherited.bytesFreed());
+
+    RefPtr<RenderStyle> other = createStyleWithColor(Color(255, 0, 0));
+    other->internData(interners);
+    EXPECT_FALSE(first->inheritedDataShared(other.get()));
+    EXPECT_EQ(1u, interners.inherited.hits());
+}
+
+TEST(RenderStyleTest, InternDataSkipsGroupsThatWereNotCopied)
+{
+    StyleDataInterners interners;
+
+    // All groups are still shared with the initial style.
+    RefPtr<RenderStyle> initial = RenderStyle::create();
+    initial->internData(interners);
+    EXPECT_EQ(0u, interners.inherited.lookups());
+    EXPECT_EQ(0u, interners.box.lookups());
+
+    // Inherited groups are shared with the parent.
+    RefPtr<RenderStyle> parent = createStyleWithColor(Color(0, 128, 0));
+    RefPtr<RenderStyle> child = RenderStyle::create();
+    child->inheritFrom(parent.get());
+    child->internData(interners);
+    EXPECT_EQ(0u, interners.inherited.lookups());
+
+    // Once the parent holds its copy alone it is interned, but only once.
+    child.clear();
+    parent->internData(interners);
+    parent->internData(interners);
+    EXPECT_EQ(1u, interners.inherited.lookups());
+    EXPECT_EQ(0u, interners.inherited.hits());
+}
+
+TEST(RenderStyleTest, DataInternerCountsOnlyFreedData)
+{
+    DataInterner<StyleInheritedData> interner;
+    RefPtr<StyleInheritedData> interned = interner.intern(StyleInheritedData::create());
+
+    // An equal object that is still referenced elsewhere is shared but not freed.
+    RefPtr<StyleInheritedData> referenced = StyleInheritedData::create();
+    EXPECT_EQ(interned.get(), interner.intern(referenced).get());
+    EXPECT_EQ(1u, interner.hits());
+    EXPECT_EQ(0u, interner.freedCount());
+
+    EXPECT_EQ(interned.get(), interner.intern(StyleInheritedData::create()).get());
+    EXPECT_EQ(2u, interner.hits());
+    EXPECT_EQ(1u, interner.freedCount());
+
+    // Interning an interned object is not a hit.
+    EXPECT_EQ(interned.get(), interner.intern(interned).get());
+    EXPECT_EQ(2u, interner.hits());
+}
+
+} // namespace
@@ -47,6 +47,7 @@ StyleRareNonInheritedData::StyleRareNonInheritedData()
     , m_shapeMargin(RenderStyle::initialShapeMargin())
     , m_shapeImageThreshold(RenderStyle::initialShapeImageThreshold())
     , m_clipPath(RenderStyle::initialClipPath())
+    , m_contentSkipping(RenderStyle::initialContentSkipping())
     , m_textDecorationColor(StyleColor::currentColor())
     , m_visitedLinkTextDecorationColor(StyleColor::currentColor())
     , m_visitedLinkBackgroundColor(RenderStyle::initialBackgroundColor())
@@ -131,6 +132,7 @@ StyleRareNonInheritedData::StyleRareNonInheritedData(const StyleRareNonInherited
     , m_shapeMargin(o.m_shapeMargin)
     , m_shapeImageThreshold(o.m_shapeImageThreshold)
     , m_clipPath(o.m_clipPath)
+    , m_contentSkipping(o.m_contentSkipping)
     , m_textDecorationColor(o.m_textDecorationColor)
     , m_visitedLinkTextDecorationColor(o.m_visitedLinkTextDecorationColor)
     , m_visitedLinkBackgroundColor(o.m_visitedLinkBackgroundColor)
@@ -221,6 +223,7 @@ bool StyleRareNonInheritedData::operator==(const StyleRareNonInheritedData& o) c
         && m_shapeMargin == o.m_shapeMargin
         && m_shapeImageThreshold == o.m_shapeImageThreshold
         && m_clipPath == o.m_clipPath
+        && m_contentSkipping == o.m_contentSkipping
         && m_textDecorationColor == o.m_textDecorationColor
         && m_visitedLinkTextDecorationColor == o.m_visitedLinkTextDecorationColor
         && m_visitedLinkBackgroundColor == o.m_visitedLinkBackgroundColor
@@ -135,6 +135,8 @@ public:
 
     RefPtr<ClipPathOperation> m_clipPath;
 
+    Length m_contentSkipping;
+
     StyleColor m_textDecorationColor;
     StyleColor m_visitedLinkTextDecorationColor;
     StyleColor m_visitedLinkBackgroundColor;
@@ -130,6 +130,7 @@
 #include "platform/geometry/IntRect.h"
 #include "platform/geometry/LayoutRect.h"
 #include "platform/graphics/GraphicsLayer.h"
+#include "platform/graphics/PaintInvalidationRegion.h"
 #include "platform/graphics/filters/FilterOperation.h"
 #include "platform/graphics/filters/FilterOperations.h"
 #include "platform/weborigin/SchemeRegistry.h"
@@ -232,6 +233,8 @@ void Internals::resetToConsistentState(Page* page)
     if (ScrollingCoordinator* scrollingCoordinator = page->scrollingCoordinator())
         scrollingCoordinator->reset();
 
+    PaintInvalidationRegion::resetLimits();
+
     page->deprecatedLocalMainFrame()->view()->clear();
 }
 
@@ -1842,6 +1845,39 @@ void Internals::forceFullRepaint(Document* document, ExceptionState& exceptionSt
         renderView->invalidatePaintForViewAndCompositedLayers();
 }
 
+void Internals::setPaintInvalidationCoalescingLimits(unsigned maxRectCount, float maxWastedAreaRatio, ExceptionState& exceptionState)
+{
+    if (!maxRectCount) {
+        exceptionState.throwDOMException(IndexSizeError, "The maximum rect count must be positive.");
+        return;
+    }
+    if (!(maxWastedAreaRatio >= 0 && maxWastedAreaRatio <= 1)) {
+        exceptionState.throwDOMException(IndexSizeError, "The maximum wasted area ratio must be between 0 and 1.");
+        return;
+    }
+    PaintInvalidationRegion::setLimits(maxRectCount, maxWastedAreaRatio);
+}
+
+void Internals::resetPaintInvalidationAreaCounters()
+{
+    GraphicsLayer::resetPaintInvalidationAreaCounters();
+}
+
+double Internals::requestedPaintInvalidationArea() const
+{
+    return GraphicsLayer::paintInvalidationAreaCounters().requestedArea;
+}
+
+double Internals::invalidatedPaintArea() const
+{
+    return GraphicsLayer::paintInvalidationAreaCounters().invalidatedArea;
+}
+
+double Internals::paintedArea() const
+{
+    return GraphicsLayer::paintInvalidationAreaCounters().paintedArea;
+}
+
 PassRefPtrWillBeRawPtr<ClientRectList> Internals::draggableRegions(Document* document, ExceptionState& exceptionState)
 {
     return annotatedRegions(document, true, exceptionState);
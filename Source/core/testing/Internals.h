@@ -267,6 +267,12 @@ public:
     void updateLayoutIgnorePendingStylesheetsAndRunPostLayoutTasks(Node*, ExceptionState&);
     void forceFullRepaint(Document*, ExceptionState&);
 
+    void setPaintInvalidationCoalescingLimits(unsigned maxRectCount, float maxWastedAreaRatio, ExceptionState&);
+    void resetPaintInvalidationAreaCounters();
+    double requestedPaintInvalidationArea() const;
+    double invalidatedPaintArea() const;
+    double paintedArea() const;
+
     PassRefPtrWillBeRawPtr<ClientRectList> draggableRegions(Document*, ExceptionState&);
     PassRefPtrWillBeRawPtr<ClientRectList> nonDraggableRegions(Document*, ExceptionState&);
 
@@ -0,0 +1,245 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "platform/ParallelWorkerPool.h"
+
+#include "platform/Task.h"
+#include "platform/TraceEvent.h"
+#include "platform/heap/ThreadState.h"
+#include "public/platform/Platform.h"
+#include "wtf/PassOwnPtr.h"
+#include "wtf/PassRefPtr.h"
+#include "wtf/ThreadSafeRefCounted.h"
+#include "wtf/Threading.h"
+#include <algorithm>
+
+namespace blink {
+
+// Bounds the number of threads kept alive on machines with many cores.
+static const size_t maximumWorkerThreadCount = 15;
+
+// The state of one parallelFor() call. It is reference counted because tasks posted to busy
+// worker threads may only run after the call has returned, in which case they find no work
+// left and must not touch anything on the caller's stack.
+class ParallelWorkerPool::Job : public ThreadSafeRefCounted<Job> {
+public:
+    static PassRefPtr<Job> create(size_t count, size_t grainSize, size_t participantCount, Body& body)
+    {
+        return adoptRef(new Job(count, grainSize, participantCount, body));
+    }
+
+    static void participateOnWorkerThread(PassRefPtr<Job> job, size_t participant)
+    {
+        TRACE_EVENT0("blink", "ParallelWorkerPool::participateOnWorkerThread");
+        job->participate(participant);
+    }
+
+    // Processes chunks until neither this participant's range nor any other has work left.
+    void participate(size_t participant)
+    {
+        while (true) {
+            size_t begin;
+            size_t end;
+            if (!takeChunk(participant, begin, end)) {
+                if (!stealRange(participant))
+                    return;
+                continue;
+            }
+            m_body->run(begin, end);
+            didProcess(end - begin);
+        }
+    }
+
+    void waitForCompletion()
+    {
+        if (ThreadState::current()) {
+            // The worker threads never enter the heap, but other attached threads might want
+            // to garbage collect while we wait.
+            ThreadState::SafePointScope scope(ThreadState::HeapPointersOnStack);
+            waitForCompletionInternal();
+        } else {
+            waitForCompletionInternal();
+        }
+    }
+
+private:
+    // The part of [0, count) a participant hasn't processed yet. Its owner takes chunks off
+    // the front, thieves split off the back.
+    struct Range {
+        WTF_MAKE_NONCOPYABLE(Range); WTF_MAKE_FAST_ALLOCATED;
+    public:
+        Range(size_t begin, size_t end)
+            : begin(begin)
+            , end(end)
+        {
+        }
+
+        Mutex mutex;
+        size_t begin;
+        size_t end;
+    };
+
+    Job(size_t count, size_t grainSize, size_t participantCount, Body& body)
+        : m_body(&body)
+        , m_count(count)
+        , m_grainSize(grainSize)
+        , m_processedCount(0)
+    {
+        ASSERT(participantCount);
+        // Split the items as evenly as possible; the first count % participantCount ranges
+        // get one extra item.
+        size_t itemsPerParticipant = count / participantCount;
+        size_t participantsWithExtra = count % participantCount;
+        size_t begin = 0;
+        for (size_t i = 0; i < participantCount; ++i) {
+            size_t end = begin + itemsPerParticipant + (i < participantsWithExtra ? 1 : 0);
+            m_ranges.append(adoptPtr(new Range(begin, end)));
+            begin = end;
+        }
+        ASSERT(begin == count);
+    }
+
+    bool takeChunk(size_t participant, size_t& begin, size_t& end)
+    {
+        Range& range = *m_ranges[participant];
+        MutexLocker locker(range.mutex);
+        if (range.begin == range.end)
+            return false;
+        begin = range.begin;
+        end = std::min(range.end, begin + m_grainSize);
+        range.begin = end;
+        return true;
+    }
+
+    // Moves the back half of the first other range that has work left into the participant's
+    // own range, which must be empty. A range of at most one chunk is taken whole.
+    bool stealRange(size_t participant)
+    {
+        size_t participantCount = m_ranges.size();
+        for (size_t i = 1; i < participantCount; ++i) {
+            Range& victim = *m_ranges[(participant + i) % participantCount];
+            size_t begin;
+            size_t end;
+            {
+                MutexLocker locker(victim.mutex);
+                size_t remaining = victim.end - victim.begin;
+                if (!remaining)
+                    continue;
+                begin = remaining <= m_grainSize ? victim.begin : victim.begin + remaining / 2;
+                end = victim.end;
+                victim.end = begin;
+            }
+            Range& range = *m_ranges[participant];
+            MutexLocker locker(range.mutex);
+            ASSERT(range.begin == range.end);
+            range.begin = begin;
+            range.end = end;
+            return true;
+        }
+        return false;
+    }
+
+    void didProcess(size_t itemCount)
+    {
+        MutexLocker locker(m_completionMutex);
+        m_processedCount += itemCount;
+        ASSERT(m_processedCount <= m_count);
+        if (m_processedCount == m_count)
+            m_completionCondition.signal();
+    }
+
+    void waitForCompletionInternal()
+    {
+        MutexLocker locker(m_completionMutex);
+        while (m_processedCount < m_count)
+            m_completionCondition.wait(m_completionMutex);
+    }
+
+    // Only dereferenced while there are unprocessed items, i.e. before parallelFor() returns.
+    Body* m_body;
+    const size_t m_count;
+    const size_t m_grainSize;
+    Vector<OwnPtr<Range> > m_ranges;
+
+    Mutex m_completionMutex;
+    ThreadCondition m_completionCondition;
+    size_t m_processedCount;
+};
+
+ParallelWorkerPool& ParallelWorkerPool::shared()
+{
+    AtomicallyInitializedStatic(ParallelWorkerPool&, pool = *new ParallelWorkerPool);
+    return pool;
+}
+
+ParallelWorkerPool::ParallelWorkerPool()
+    : m_workerThreadsStarted(false)
+    , m_nextTaskThread(0)
+{
+}
+
+void ParallelWorkerPool::startWorkerThreadsIfNeeded()
+{
+    MutexLocker locker(m_mutex);
+    if (m_workerThreadsStarted)
+        return;
+
+    // The calling thread always participates, so one core is left for it.
+    size_t processorCount = Platform::current()->numberOfProcessors();
+    size_t workerThreadCount = std::min(std::max<size_t>(processorCount, 2) - 1, maximumWorkerThreadCount);
+    for (size_t i = 0; i < workerThreadCount; ++i) {
+        OwnPtr<WebThread> thread = adoptPtr(Platform::current()->createThread("ParallelWorker"));
+        // Platforms without threads run everything on the calling thread.
+        if (!thread)
+            break;
+        m_workerThreads.append(thread.release());
+    }
+    m_workerThreadsStarted = true;
+}
+
+size_t ParallelWorkerPool::maximumParallelism()
+{
+    startWorkerThreadsIfNeeded();
+    MutexLocker locker(m_mutex);
+    return m_workerThreads.size() + 1;
+}
+
+void ParallelWorkerPool::postTask(WebThread::Task* task)
+{
+    startWorkerThreadsIfNeeded();
+    MutexLocker locker(m_mutex);
+    ASSERT(!m_workerThreads.isEmpty());
+    m_workerThreads[m_nextTaskThread]->postTask(task);
+    m_nextTaskThread = (m_nextTaskThread + 1) % m_workerThreads.size();
+}
+
+void ParallelWorkerPool::parallelFor(size_t count, size_t grainSize, Body& body)
+{
+    if (!count)
+        return;
+    if (!grainSize)
+        grainSize = 1;
+    if (count <= grainSize) {
+        body.run(0, count);
+        return;
+    }
+
+    size_t chunkCount = (count + grainSize - 1) / grainSize;
+    size_t participantCount = std::min(chunkCount, maximumParallelism());
+    if (participantCount == 1) {
+        body.run(0, count);
+        return;
+    }
+
+    TRACE_EVENT2("blink", "ParallelWorkerPool::parallelFor", "count", static_cast<unsigned long long>(count), "grainSize", static_cast<unsigned long long>(grainSize));
+    RefPtr<Job> job = Job::create(count, grainSize, participantCount, body);
+    // m_workerThreads doesn't change once started, so it can be used without holding m_mutex.
+    for (size_t i = 1; i < participantCount; ++i)
+        m_workerThreads[i - 1]->postTask(new Task(WTF::bind(&Job::participateOnWorkerThread, job, i)));
+    job->participate(0);
+    job->waitForCompletion();
+}
+
+} // namespace blink
@@ -0,0 +1,107 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef ParallelWorkerPool_h
+#define ParallelWorkerPool_h
+
+#include "platform/PlatformExport.h"
+#include "public/platform/WebThread.h"
+#include "wtf/Noncopyable.h"
+#include "wtf/OwnPtr.h"
+#include "wtf/ThreadingPrimitives.h"
+#include "wtf/Vector.h"
+
+// Usage:
+//
+//     static void worker(Parameters* parameters, size_t begin, size_t end)
+//     {
+//         for (size_t i = begin; i < end; ++i)
+//             ...
+//     }
+//
+//     Parameters parameters;
+//     ...
+//     parallelFor(count, grainSize, &worker, &parameters);
+//
+
+namespace blink {
+
+// A process wide pool of worker threads that are started on first use and kept alive, so
+// that running a small job in parallel doesn't pay for creating and joining threads.
+//
+// parallelFor() splits [0, count) into one contiguous range per participating thread. Each
+// thread works through its own range in chunks of grainSize items and, when it runs out,
+// steals the back half of what remains of another thread's range. The calling thread
+// participates too and returns when every item has been processed, so parallelFor() can be
+// called from any thread, including from a worker function.
+class PLATFORM_EXPORT ParallelWorkerPool {
+    WTF_MAKE_NONCOPYABLE(ParallelWorkerPool);
+public:
+    class Body {
+    public:
+        virtual ~Body() { }
+        // Called with disjoint, non-empty ranges that together cover [0, count), possibly on
+        // several threads at once.
+        virtual void run(size_t begin, size_t end) = 0;
+    };
+
+    static ParallelWorkerPool& shared();
+
+    // The number of threads, including the calling thread, a parallelFor() can use.
+    size_t maximumParallelism();
+
+    // Runs serially on the calling thread when count isn't larger than grainSize.
+    void parallelFor(size_t count, size_t grainSize, Body&);
+
+    template<typename Type>
+    void parallelFor(size_t count, size_t grainSize, void (*function)(Type*, size_t begin, size_t end), Type* parameters)
+    {
+        FunctionBody<Type> body(function, parameters);
+        parallelFor(count, grainSize, body);
+    }
+
+    // Runs a task that doesn't need to be waited for on one of the worker threads, which take
+    // turns. Must only be called when maximumParallelism() is larger than one. Long tasks
+    // delay the parallelFor() calls that want the same thread, but can't block them, since
+    // the calling thread steals whatever work a busy worker thread hasn't started.
+    void postTask(WebThread::Task*);
+
+private:
+    template<typename Type>
+    class FunctionBody FINAL : public Body {
+    public:
+        FunctionBody(void (*function)(Type*, size_t, size_t), Type* parameters)
+            : m_function(function)
+            , m_parameters(parameters)
+        {
+        }
+
+        virtual void run(size_t begin, size_t end) OVERRIDE { m_function(m_parameters, begin, end); }
+
+    private:
+        void (*m_function)(Type*, size_t, size_t);
+        Type* m_parameters;
+    };
+
+    class Job;
+
+    ParallelWorkerPool();
+
+    void startWorkerThreadsIfNeeded();
+
+    Mutex m_mutex;
+    bool m_workerThreadsStarted;
+    Vector<OwnPtr<WebThread> > m_workerThreads;
+    size_t m_nextTaskThread;
+};
+
+template<typename Type>
+inline void parallelFor(size_t count, size_t grainSize, void (*function)(Type*, size_t begin, size_t end), Type* parameters)
+{
+    ParallelWorkerPool::shared().parallelFor(count, grainSize, function, parameters);
+}
+
+} // namespace blink
+
+#endif // ParallelWorkerPool_h
@@ -67,6 +67,7 @@ LOCAL_SRC_FILES := \
 	third_party/WebKit/Source/platform/MIMETypeRegistry.cpp \
 	third_party/WebKit/Source/platform/NotImplemented.cpp \
 	third_party/WebKit/Source/platform/OverscrollTheme.cpp \
+	third_party/WebKit/Source/platform/ParallelWorkerPool.cpp \
 	third_party/WebKit/Source/platform/Partitions.cpp \
 	third_party/WebKit/Source/platform/PermissionCallbacks.cpp \
 	third_party/WebKit/Source/platform/PlatformInstrumentation.cpp \
@@ -316,6 +317,7 @@ LOCAL_SRC_FILES := \
 	third_party/WebKit/Source/platform/graphics/Image.cpp \
 	third_party/WebKit/Source/platform/graphics/ImageBuffer.cpp \
 	third_party/WebKit/Source/platform/graphics/ImageBufferSurface.cpp \
+	third_party/WebKit/Source/platform/graphics/ImageDecodeScheduler.cpp \
 	third_party/WebKit/Source/platform/graphics/ImageDecodingStore.cpp \
 	third_party/WebKit/Source/platform/graphics/ImageFilter.cpp \
 	third_party/WebKit/Source/platform/graphics/ImageFrameGenerator.cpp \
@@ -324,6 +326,7 @@ LOCAL_SRC_FILES := \
 	third_party/WebKit/Source/platform/graphics/ImageSource.cpp \
 	third_party/WebKit/Source/platform/graphics/LoggingCanvas.cpp \
 	third_party/WebKit/Source/platform/graphics/ContentLayerDelegate.cpp \
+	third_party/WebKit/Source/platform/graphics/PaintInvalidationRegion.cpp \
 	third_party/WebKit/Source/platform/graphics/Path.cpp \
 	third_party/WebKit/Source/platform/graphics/PathTraversalState.cpp \
 	third_party/WebKit/Source/platform/graphics/Pattern.cpp \
@@ -34,6 +34,7 @@
 #include "platform/fonts/FontPlatformData.h"
 #include "hb-ot.h"
 #include "hb.h"
+#include "wtf/MainThread.h"
 
 namespace blink {
 
@@ -73,6 +74,7 @@ typedef HashMap<uint64_t, RefPtr<FaceCacheEntry>, WTF::IntHash<uint64_t>, WTF::U
 
 static HarfBuzzFaceCache* harfBuzzFaceCache()
 {
+    ASSERT(isMainThread());
     DEFINE_STATIC_LOCAL(HarfBuzzFaceCache, s_harfBuzzFaceCache, ());
     return &s_harfBuzzFaceCache;
 }
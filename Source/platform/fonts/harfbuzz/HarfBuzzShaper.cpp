@@ -41,8 +41,11 @@
 #include "platform/fonts/harfbuzz/HarfBuzzFace.h"
 #include "platform/text/SurrogatePairAwareTextIterator.h"
 #include "platform/text/TextBreakIterator.h"
+#include "public/platform/Platform.h"
 #include "wtf/Compiler.h"
+#include "wtf/MainThread.h"
 #include "wtf/MathExtras.h"
+#include "wtf/StringHasher.h"
 #include "wtf/unicode/Unicode.h"
 #include <unicode/normlzr.h>
 #include <unicode/uchar.h>
@@ -79,21 +82,43 @@ private:
 };
 
 
-static const unsigned cHarfBuzzCacheMaxSize = 256;
+// Shaping results are cached per word, so the same word shaped for width
+// measurement, line breaking and painting is only handed to HarfBuzz once.
+static const unsigned cHarfBuzzCacheMaxSize = 1024;
+static const size_t cHarfBuzzCacheMaxBytes = 1024 * 1024;
+static const unsigned cHarfBuzzCacheStatsInterval = 10000;
+// Longer words rarely repeat and would take a large share of the byte budget.
+static const unsigned cHarfBuzzCacheMaxWordLength = 128;
 
+struct CachedShapingResultsKey;
 struct CachedShapingResultsLRUNode;
 struct CachedShapingResults;
-typedef std::map<std::wstring, CachedShapingResults*> CachedShapingResultsMap;
+typedef std::map<CachedShapingResultsKey, CachedShapingResults*> CachedShapingResultsMap;
 typedef std::list<CachedShapingResultsLRUNode*> CachedShapingResultsLRU;
 
+struct CachedShapingResultsKey {
+    CachedShapingResultsKey(const FontPlatformData&, hb_script_t, hb_direction_t, unsigned featuresHash, const UChar* text, unsigned length);
+
+    bool operator<(const CachedShapingResultsKey&) const;
+
+    unsigned fontHash;
+    hb_script_t script;
+    hb_direction_t dir;
+    unsigned featuresHash;
+    std::wstring text;
+};
+
 struct CachedShapingResults {
-    CachedShapingResults(hb_buffer_t* harfBuzzBuffer, const Font* runFont, hb_direction_t runDir, const String& newLocale);
+    CachedShapingResults(hb_buffer_t* harfBuzzBuffer, const FontPlatformData&, const Vector<hb_feature_t, 4>& runFeatures, const String& newLocale, size_t textLength);
     ~CachedShapingResults();
 
+    bool matches(const FontPlatformData&, const Vector<hb_feature_t, 4>& runFeatures, const String& runLocale) const;
+
     hb_buffer_t* buffer;
-    Font font;
-    hb_direction_t dir;
+    FontPlatformData platformData;
+    Vector<hb_feature_t, 4> features;
     String locale;
+    size_t byteSize;
     CachedShapingResultsLRU::iterator lru;
 };
 
@@ -104,11 +129,35 @@ struct CachedShapingResultsLRUNode {
     CachedShapingResultsMap::iterator entry;
 };
 
-CachedShapingResults::CachedShapingResults(hb_buffer_t* harfBuzzBuffer, const Font* fontData, hb_direction_t dirData, const String& newLocale)
+CachedShapingResultsKey::CachedShapingResultsKey(const FontPlatformData& platformData, hb_script_t runScript, hb_direction_t runDir, unsigned runFeaturesHash, const UChar* runText, unsigned length)
+    : fontHash(platformData.hash())
+    , script(runScript)
+    , dir(runDir)
+    , featuresHash(runFeaturesHash)
+    , text(runText, runText + length)
+{
+}
+
+bool CachedShapingResultsKey::operator<(const CachedShapingResultsKey& other) const
+{
+    if (fontHash != other.fontHash)
+        return fontHash < other.fontHash;
+    if (script != other.script)
+        return script < other.script;
+    if (dir != other.dir)
+        return dir < other.dir;
+    if (featuresHash != other.featuresHash)
+        return featuresHash < other.featuresHash;
+    return text < other.text;
+}
+
+CachedShapingResults::CachedShapingResults(hb_buffer_t* harfBuzzBuffer, const FontPlatformData& runPlatformData, const Vector<hb_feature_t, 4>& runFeatures, const String& newLocale, size_t textLength)
     : buffer(harfBuzzBuffer)
-    , font(*fontData)
-    , dir(dirData)
+    , platformData(runPlatformData)
+    , features(runFeatures)
     , locale(newLocale)
+    , byteSize(sizeof(CachedShapingResults) + textLength * sizeof(wchar_t)
+        + hb_buffer_get_length(harfBuzzBuffer) * (sizeof(hb_glyph_info_t) + sizeof(hb_glyph_position_t)))
 {
 }
 
@@ -117,6 +166,14 @@ CachedShapingResults::~CachedShapingResults()
     hb_buffer_destroy(buffer);
 }
 
+bool CachedShapingResults::matches(const FontPlatformData& runPlatformData, const Vector<hb_feature_t, 4>& runFeatures, const String& runLocale) const
+{
+    // The key only holds hashes of the font and the features, so guard against collisions.
+    if (!(platformData == runPlatformData) || locale != runLocale || features.size() != runFeatures.size())
+        return false;
+    return !features.size() || !memcmp(features.data(), runFeatures.data(), features.size() * sizeof(hb_feature_t));
+}
+
 CachedShapingResultsLRUNode::CachedShapingResultsLRUNode(const CachedShapingResultsMap::iterator& cacheEntry)
     : entry(cacheEntry)
 {
@@ -131,18 +188,30 @@ public:
     HarfBuzzRunCache();
     ~HarfBuzzRunCache();
 
-    CachedShapingResults* find(const std::wstring& key) const;
+    CachedShapingResults* find(const CachedShapingResultsKey&) const;
     void remove(CachedShapingResults* node);
     void moveToBack(CachedShapingResults* node);
-    bool insert(const std::wstring& key, CachedShapingResults* run);
+    bool insert(const CachedShapingResultsKey&, CachedShapingResults* run);
+
+    void recordLookup(bool hit);
+
+    size_t size() const { return m_harfBuzzRunMap.size(); }
 
 private:
+    void removeLeastRecentlyUsed();
+
     CachedShapingResultsMap m_harfBuzzRunMap;
     CachedShapingResultsLRU m_harfBuzzRunLRU;
+    size_t m_byteSize;
+    unsigned m_hits;
+    unsigned m_misses;
 };
 
 
 HarfBuzzRunCache::HarfBuzzRunCache()
+    : m_byteSize(0)
+    , m_hits(0)
+    , m_misses(0)
 {
 }
 
@@ -154,7 +223,7 @@ HarfBuzzRunCache::~HarfBuzzRunCache()
         delete *it;
 }
 
-bool HarfBuzzRunCache::insert(const std::wstring& key, CachedShapingResults* data)
+bool HarfBuzzRunCache::insert(const CachedShapingResultsKey& key, CachedShapingResults* data)
 {
     std::pair<CachedShapingResultsMap::iterator, bool> results =
         m_harfBuzzRunMap.insert(CachedShapingResultsMap::value_type(key, data));
@@ -166,20 +235,16 @@ bool HarfBuzzRunCache::insert(const std::wstring& key, CachedShapingResults* dat
 
     m_harfBuzzRunLRU.push_back(node);
     data->lru = --m_harfBuzzRunLRU.end();
+    m_byteSize += data->byteSize;
 
-    if (m_harfBuzzRunMap.size() > cHarfBuzzCacheMaxSize) {
-        CachedShapingResultsLRUNode* lru = m_harfBuzzRunLRU.front();
-        CachedShapingResults* foo = lru->entry->second;
-        m_harfBuzzRunMap.erase(lru->entry);
-        m_harfBuzzRunLRU.pop_front();
-        delete foo;
-        delete lru;
-    }
+    // Never evict the entry that was just added, even if it alone exceeds the budget.
+    while (m_harfBuzzRunMap.size() > 1 && (m_harfBuzzRunMap.size() > cHarfBuzzCacheMaxSize || m_byteSize > cHarfBuzzCacheMaxBytes))
+        removeLeastRecentlyUsed();
 
     return true;
 }
 
-inline CachedShapingResults* HarfBuzzRunCache::find(const std::wstring& key) const
+inline CachedShapingResults* HarfBuzzRunCache::find(const CachedShapingResultsKey& key) const
 {
     CachedShapingResultsMap::const_iterator it = m_harfBuzzRunMap.find(key);
 
@@ -190,12 +255,19 @@ inline void HarfBuzzRunCache::remove(CachedShapingResults* node)
 {
     CachedShapingResultsLRUNode* lruNode = *node->lru;
 
+    ASSERT(m_byteSize >= node->byteSize);
+    m_byteSize -= node->byteSize;
     m_harfBuzzRunLRU.erase(node->lru);
     m_harfBuzzRunMap.erase(lruNode->entry);
     delete lruNode;
     delete node;
 }
 
+inline void HarfBuzzRunCache::removeLeastRecentlyUsed()
+{
+    remove(m_harfBuzzRunLRU.front()->entry->second);
+}
+
 inline void HarfBuzzRunCache::moveToBack(CachedShapingResults* node)
 {
     CachedShapingResultsLRUNode* lruNode = *node->lru;
@@ -204,12 +276,37 @@ inline void HarfBuzzRunCache::moveToBack(CachedShapingResults* node)
     node->lru = --m_harfBuzzRunLRU.end();
 }
 
+void HarfBuzzRunCache::recordLookup(bool hit)
+{
+    if (hit)
+        ++m_hits;
+    else
+        ++m_misses;
+
+    unsigned lookups = m_hits + m_misses;
+    if (lookups < cHarfBuzzCacheStatsInterval)
+        return;
+
+    if (Platform* platform = Platform::current())
+        platform->histogramEnumeration("Blink.Fonts.ShapeCache.HitRatePercent", m_hits * 100 / lookups, 101);
+    m_hits = 0;
+    m_misses = 0;
+}
+
 HarfBuzzRunCache& harfBuzzRunCache()
 {
+    // Shaping goes through HarfBuzzFace and SimpleFontData, which are only
+    // usable on the main thread, so the cache is not guarded by a lock.
+    ASSERT(isMainThread());
     DEFINE_STATIC_LOCAL(HarfBuzzRunCache, globalHarfBuzzRunCache, ());
     return globalHarfBuzzRunCache;
 }
 
+size_t HarfBuzzShaper::shapeCacheSizeForTesting()
+{
+    return harfBuzzRunCache().size();
+}
+
 static inline float harfBuzzPositionToFloat(hb_position_t value)
 {
     return static_cast<float>(value) / (1 << 16);
@@ -265,13 +362,15 @@ HarfBuzzShaper::HarfBuzzRun::~HarfBuzzRun()
 {
 }
 
-inline void HarfBuzzShaper::HarfBuzzRun::applyShapeResult(hb_buffer_t* harfBuzzBuffer)
+inline unsigned HarfBuzzShaper::HarfBuzzRun::appendShapeResult(hb_buffer_t* harfBuzzBuffer)
 {
-    m_numGlyphs = hb_buffer_get_length(harfBuzzBuffer);
+    unsigned glyphOffset = m_numGlyphs;
+    m_numGlyphs += hb_buffer_get_length(harfBuzzBuffer);
     m_glyphs.resize(m_numGlyphs);
     m_advances.resize(m_numGlyphs);
     m_glyphToCharacterIndexes.resize(m_numGlyphs);
     m_offsets.resize(m_numGlyphs);
+    return glyphOffset;
 }
 
 inline void HarfBuzzShaper::HarfBuzzRun::setGlyphAndPositions(unsigned index, uint16_t glyphId, float advance, float offsetX, float offsetY)
@@ -817,14 +916,75 @@ static const uint16_t* toUint16(const UChar* src)
     return reinterpret_cast<const uint16_t*>(src);
 }
 
-bool HarfBuzzShaper::shapeHarfBuzzRuns()
+static inline bool isCacheableWord(unsigned numCharacters)
+{
+    return numCharacters <= cHarfBuzzCacheMaxWordLength;
+}
+
+hb_buffer_t* HarfBuzzShaper::shapeWord(HarfBuzzRun* currentRun, HarfBuzzFace* face, HarfBuzzScopedPtr<hb_font_t>& harfBuzzFont, unsigned startIndex, unsigned numCharacters, unsigned featuresHash, const String& localeString)
 {
-    HarfBuzzScopedPtr<hb_buffer_t> harfBuzzBuffer(hb_buffer_create(), hb_buffer_destroy);
+    const FontDescription& fontDescription = m_font->fontDescription();
+    const FontPlatformData& platformData = currentRun->fontData()->platformData();
+
+    String upperText;
+    const UChar* text = m_normalizedBuffer.get() + startIndex;
+    if (fontDescription.variant() == FontVariantSmallCaps && u_islower(text[0])) {
+        upperText = String(text, numCharacters).upper();
+        ASSERT(!upperText.is8Bit()); // m_normalizedBuffer is 16 bit, therefore upperText is 16 bit, even after we call makeUpper().
+        text = upperText.characters16();
+    }
 
+    // The key holds the text that is actually handed to HarfBuzz, so small caps
+    // words share their results with upper case words of the same font.
     HarfBuzzRunCache& runCache = harfBuzzRunCache();
-    const FontDescription& fontDescription = m_font->fontDescription();
-    const String& localeString = fontDescription.locale();
+    CachedShapingResultsKey key(platformData, currentRun->script(), currentRun->direction(), featuresHash, text, numCharacters);
+    bool cacheable = isCacheableWord(numCharacters);
+    if (cacheable) {
+        CachedShapingResults* cachedResults = runCache.find(key);
+        if (cachedResults) {
+            if (cachedResults->matches(platformData, m_features, localeString)) {
+                runCache.moveToBack(cachedResults);
+                runCache.recordLookup(true);
+                return cachedResults->buffer;
+            }
+
+            runCache.remove(cachedResults);
+        }
+        runCache.recordLookup(false);
+    }
+
+    hb_buffer_t* harfBuzzBuffer = hb_buffer_create();
     CString locale = localeString.latin1();
+    hb_buffer_set_language(harfBuzzBuffer, hb_language_from_string(locale.data(), locale.length()));
+    hb_buffer_set_script(harfBuzzBuffer, currentRun->script());
+    hb_buffer_set_direction(harfBuzzBuffer, currentRun->direction());
+
+    // Add a space as pre-context to the buffer. This prevents showing dotted-circle
+    // for combining marks at the beginning of runs.
+    static const uint16_t preContext = space;
+    hb_buffer_add_utf16(harfBuzzBuffer, &preContext, 1, 1, 0);
+    hb_buffer_add_utf16(harfBuzzBuffer, toUint16(text), numCharacters, 0, numCharacters);
+
+    if (fontDescription.orientation() == Vertical)
+        face->setScriptForVerticalGlyphSubstitution(harfBuzzBuffer);
+
+    // The font is shared by all the words of the run that miss the cache.
+    if (!harfBuzzFont.get())
+        harfBuzzFont.set(face->createFont());
+
+    hb_shape(harfBuzzFont.get(), harfBuzzBuffer, m_features.isEmpty() ? 0 : m_features.data(), m_features.size());
+
+    if (cacheable) {
+        bool inserted = runCache.insert(key, new CachedShapingResults(harfBuzzBuffer, platformData, m_features, localeString, numCharacters));
+        ASSERT_UNUSED(inserted, inserted);
+    }
+    return harfBuzzBuffer;
+}
+
+bool HarfBuzzShaper::shapeHarfBuzzRuns()
+{
+    unsigned featuresHash = m_features.isEmpty() ? 0 : StringHasher::hashMemory(m_features.data(), m_features.size() * sizeof(hb_feature_t));
+    const String& localeString = m_font->fontDescription().locale();
 
     for (unsigned i = 0; i < m_harfBuzzRuns.size(); ++i) {
         unsigned runIndex = m_run.rtl() ? m_harfBuzzRuns.size() - i - 1 : i;
@@ -838,75 +998,62 @@ bool HarfBuzzShaper::shapeHarfBuzzRuns()
         if (!face)
             return false;
 
-        hb_buffer_set_language(harfBuzzBuffer.get(), hb_language_from_string(locale.data(), locale.length()));
-        hb_buffer_set_script(harfBuzzBuffer.get(), currentRun->script());
-        hb_buffer_set_direction(harfBuzzBuffer.get(), currentRun->direction());
-
-        const UChar* src = m_normalizedBuffer.get() + currentRun->startIndex();
-        std::wstring key(src, src + currentRun->numCharacters());
-
-        CachedShapingResults* cachedResults = runCache.find(key);
-        if (cachedResults) {
-            if (cachedResults->dir == currentRun->direction() && cachedResults->font == *m_font && cachedResults->locale == localeString) {
-                currentRun->applyShapeResult(cachedResults->buffer);
-                setGlyphPositionsForHarfBuzzRun(currentRun, cachedResults->buffer);
-
-                hb_buffer_clear_contents(harfBuzzBuffer.get());
-
-                runCache.moveToBack(cachedResults);
-
-                continue;
+        // Shape every word and every sequence of spaces on its own, so that words
+        // measured separately during line breaking hit the cache when the whole
+        // line is shaped for painting. Fonts may kern or ligate across spaces, so
+        // this is behind a flag; otherwise the run is shaped as a single word.
+        Vector<unsigned, 32> wordStarts;
+        unsigned runStart = currentRun->startIndex();
+        unsigned runEnd = runStart + currentRun->numCharacters();
+        wordStarts.append(runStart);
+        if (RuntimeEnabledFeatures::shapeTextByWordEnabled()) {
+            for (unsigned j = runStart + 1; j < runEnd; ++j) {
+                if ((m_normalizedBuffer[j] == space) != (m_normalizedBuffer[j - 1] == space))
+                    wordStarts.append(j);
             }
-
-            runCache.remove(cachedResults);
         }
-
-        // Add a space as pre-context to the buffer. This prevents showing dotted-circle
-        // for combining marks at the beginning of runs.
-        static const uint16_t preContext = space;
-        hb_buffer_add_utf16(harfBuzzBuffer.get(), &preContext, 1, 1, 0);
-
-        if (fontDescription.variant() == FontVariantSmallCaps && u_islower(m_normalizedBuffer[currentRun->startIndex()])) {
-            String upperText = String(m_normalizedBuffer.get() + currentRun->startIndex(), currentRun->numCharacters()).upper();
-            ASSERT(!upperText.is8Bit()); // m_normalizedBuffer is 16 bit, therefore upperText is 16 bit, even after we call makeUpper().
-            hb_buffer_add_utf16(harfBuzzBuffer.get(), toUint16(upperText.characters16()), currentRun->numCharacters(), 0, currentRun->numCharacters());
-        } else {
-            hb_buffer_add_utf16(harfBuzzBuffer.get(), toUint16(m_normalizedBuffer.get() + currentRun->startIndex()), currentRun->numCharacters(), 0, currentRun->numCharacters());
+        wordStarts.append(runEnd);
+
+        // HarfBuzz returns glyphs in visual order, so the words of RTL runs are appended last to first.
+        HarfBuzzScopedPtr<hb_font_t> harfBuzzFont(0, hb_font_destroy);
+        FloatPoint glyphOrigin;
+        float totalAdvance = 0;
+        unsigned numWords = wordStarts.size() - 1;
+        for (unsigned j = 0; j < numWords; ++j) {
+            unsigned wordIndex = currentRun->rtl() ? numWords - j - 1 : j;
+            unsigned wordStart = wordStarts[wordIndex];
+            unsigned wordLength = wordStarts[wordIndex + 1] - wordStart;
+            hb_buffer_t* harfBuzzBuffer = shapeWord(currentRun, face, harfBuzzFont, wordStart, wordLength, featuresHash, localeString);
+            // Buffers of words that are too long to cache are owned here.
+            HarfBuzzScopedPtr<hb_buffer_t> uncachedBuffer(isCacheableWord(wordLength) ? 0 : harfBuzzBuffer, hb_buffer_destroy);
+            unsigned glyphOffset = currentRun->appendShapeResult(harfBuzzBuffer);
+            totalAdvance += setGlyphPositionsForHarfBuzzRun(currentRun, harfBuzzBuffer, glyphOffset, wordStart - runStart, glyphOrigin);
         }
-
-        if (fontDescription.orientation() == Vertical)
-            face->setScriptForVerticalGlyphSubstitution(harfBuzzBuffer.get());
-
-        HarfBuzzScopedPtr<hb_font_t> harfBuzzFont(face->createFont(), hb_font_destroy);
-
-        hb_shape(harfBuzzFont.get(), harfBuzzBuffer.get(), m_features.isEmpty() ? 0 : m_features.data(), m_features.size());
-        currentRun->applyShapeResult(harfBuzzBuffer.get());
-        setGlyphPositionsForHarfBuzzRun(currentRun, harfBuzzBuffer.get());
-
-        runCache.insert(key, new CachedShapingResults(harfBuzzBuffer.get(), m_font, currentRun->direction(), localeString));
-
-        harfBuzzBuffer.set(hb_buffer_create());
+        currentRun->setWidth(totalAdvance > 0.0 ? totalAdvance : 0.0);
+        m_totalWidth += currentRun->width();
     }
 
     return true;
 }
 
-void HarfBuzzShaper::setGlyphPositionsForHarfBuzzRun(HarfBuzzRun* currentRun, hb_buffer_t* harfBuzzBuffer)
+float HarfBuzzShaper::setGlyphPositionsForHarfBuzzRun(HarfBuzzRun* currentRun, hb_buffer_t* harfBuzzBuffer, unsigned glyphOffset, unsigned characterOffset, FloatPoint& glyphOrigin)
 {
     const SimpleFontData* currentFontData = currentRun->fontData();
     hb_glyph_info_t* glyphInfos = hb_buffer_get_glyph_infos(harfBuzzBuffer, 0);
     hb_glyph_position_t* glyphPositions = hb_buffer_get_glyph_positions(harfBuzzBuffer, 0);
 
+    unsigned numGlyphs = hb_buffer_get_length(harfBuzzBuffer);
+    if (!numGlyphs)
+        return 0;
+
     if (!currentRun->hasGlyphToCharacterIndexes()) {
         // FIXME: https://crbug.com/337886
         ASSERT_NOT_REACHED();
-        return;
+        return 0;
     }
 
-    unsigned numGlyphs = currentRun->numGlyphs();
     uint16_t* glyphToCharacterIndexes = currentRun->glyphToCharacterIndexes();
     float totalAdvance = 0;
-    FloatPoint glyphOrigin;
 
     // HarfBuzz returns the shaping result in visual order. We need not to flip for RTL.
     for (size_t i = 0; i < numGlyphs; ++i) {
@@ -916,11 +1063,11 @@ void HarfBuzzShaper::setGlyphPositionsForHarfBuzzRun(HarfBuzzRun* currentRun, hb
         float offsetY = -harfBuzzPositionToFloat(glyphPositions[i].y_offset);
         float advance = harfBuzzPositionToFloat(glyphPositions[i].x_advance);
 
-        unsigned currentCharacterIndex = currentRun->startIndex() + glyphInfos[i].cluster;
+        unsigned currentCharacterIndex = currentRun->startIndex() + characterOffset + glyphInfos[i].cluster;
         bool isClusterEnd = runEnd || glyphInfos[i].cluster != glyphInfos[i + 1].cluster;
         float spacing = 0;
 
-        glyphToCharacterIndexes[i] = glyphInfos[i].cluster;
+        glyphToCharacterIndexes[glyphOffset + i] = characterOffset + glyphInfos[i].cluster;
 
         if (isClusterEnd && !Character::treatAsZeroWidthSpace(m_normalizedBuffer[currentCharacterIndex]))
             spacing += m_letterSpacing;
@@ -929,7 +1076,7 @@ void HarfBuzzShaper::setGlyphPositionsForHarfBuzzRun(HarfBuzzRun* currentRun, hb
             spacing += determineWordBreakSpacing();
 
         if (currentFontData->isZeroWidthSpaceGlyph(glyph)) {
-            currentRun->setGlyphAndPositions(i, glyph, 0, 0, 0);
+            currentRun->setGlyphAndPositions(glyphOffset + i, glyph, 0, 0, 0);
             continue;
         }
 
@@ -941,7 +1088,7 @@ void HarfBuzzShaper::setGlyphPositionsForHarfBuzzRun(HarfBuzzRun* currentRun, hb
                 offsetX += m_letterSpacing;
         }
 
-        currentRun->setGlyphAndPositions(i, glyph, advance, offsetX, offsetY);
+        currentRun->setGlyphAndPositions(glyphOffset + i, glyph, advance, offsetX, offsetY);
 
         FloatRect glyphBounds = currentFontData->boundsForGlyph(glyph);
         glyphBounds.move(glyphOrigin.x(), glyphOrigin.y());
@@ -950,8 +1097,7 @@ void HarfBuzzShaper::setGlyphPositionsForHarfBuzzRun(HarfBuzzRun* currentRun, hb
 
         totalAdvance += advance;
     }
-    currentRun->setWidth(totalAdvance > 0.0 ? totalAdvance : 0.0);
-    m_totalWidth += currentRun->width();
+    return totalAdvance;
 }
 
 void HarfBuzzShaper::fillGlyphBufferFromHarfBuzzRun(GlyphBuffer* glyphBuffer, HarfBuzzRun* currentRun, FloatPoint& firstOffsetOfNextRun)
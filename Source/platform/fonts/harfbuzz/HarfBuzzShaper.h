@@ -47,7 +47,9 @@ namespace blink {
 
 class Font;
 class GlyphBuffer;
+class HarfBuzzFace;
 class SimpleFontData;
+template<typename T> class HarfBuzzScopedPtr;
 
 class HarfBuzzShaper FINAL {
 public:
@@ -66,6 +68,8 @@ public:
     FloatRect selectionRect(const FloatPoint&, int height, int from, int to);
     FloatBoxExtent glyphBoundingBox() const { return m_glyphBoundingBox; }
 
+    static size_t shapeCacheSizeForTesting();
+
 private:
     class HarfBuzzRun {
     public:
@@ -77,7 +81,7 @@ private:
             return adoptPtr(new HarfBuzzRun(fontData, startIndex, numCharacters, direction, script));
         }
 
-        void applyShapeResult(hb_buffer_t*);
+        unsigned appendShapeResult(hb_buffer_t*);
         void setGlyphAndPositions(unsigned index, uint16_t glyphId, float advance, float offsetX, float offsetY);
         void setWidth(float width) { m_width = width; }
 
@@ -132,7 +136,8 @@ private:
     bool fillGlyphBuffer(GlyphBuffer*);
     void fillGlyphBufferFromHarfBuzzRun(GlyphBuffer*, HarfBuzzRun*, FloatPoint& firstOffsetOfNextRun);
     void fillGlyphBufferForTextEmphasis(GlyphBuffer*, HarfBuzzRun* currentRun);
-    void setGlyphPositionsForHarfBuzzRun(HarfBuzzRun*, hb_buffer_t*);
+    hb_buffer_t* shapeWord(HarfBuzzRun*, HarfBuzzFace*, HarfBuzzScopedPtr<hb_font_t>&, unsigned startIndex, unsigned numCharacters, unsigned featuresHash, const String& localeString);
+    float setGlyphPositionsForHarfBuzzRun(HarfBuzzRun*, hb_buffer_t*, unsigned glyphOffset, unsigned characterOffset, FloatPoint& glyphOrigin);
     void addHarfBuzzRun(unsigned startCharacter, unsigned endCharacter, const SimpleFontData*, UScriptCode);
 
     const Font* m_font;
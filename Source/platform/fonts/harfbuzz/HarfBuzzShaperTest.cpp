@@ -0,0 +1,91 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "platform/fonts/harfbuzz/HarfBuzzShaper.h"
+
+#include "platform/RuntimeEnabledFeatures.h"
+#include "platform/fonts/Font.h"
+#include "platform/fonts/FontDescription.h"
+#include "platform/text/TextRun.h"
+#include "wtf/text/StringBuilder.h"
+#include <gtest/gtest.h>
+
+namespace blink {
+
+class HarfBuzzShaperTest : public ::testing::Test {
+protected:
+    virtual void SetUp() OVERRIDE
+    {
+        m_shapeTextByWordEnabled = RuntimeEnabledFeatures::shapeTextByWordEnabled();
+
+        FontDescription fontDescription;
+        fontDescription.setGenericFamily(FontDescription::StandardFamily);
+        fontDescription.setComputedSize(12.0);
+        m_font = adoptPtr(new Font(fontDescription));
+        m_font->update(nullptr);
+    }
+
+    virtual void TearDown() OVERRIDE
+    {
+        RuntimeEnabledFeatures::setShapeTextByWordEnabled(m_shapeTextByWordEnabled);
+    }
+
+    float shapeAndReturnWidth(const String& text)
+    {
+        TextRun run(text);
+        HarfBuzzShaper shaper(m_font.get(), run);
+        EXPECT_TRUE(shaper.shape());
+        return shaper.totalWidth();
+    }
+
+private:
+    OwnPtr<Font> m_font;
+    bool m_shapeTextByWordEnabled;
+};
+
+TEST_F(HarfBuzzShaperTest, RunIsShapedWholeByDefault)
+{
+    RuntimeEnabledFeatures::setShapeTextByWordEnabled(false);
+    size_t cacheSize = HarfBuzzShaper::shapeCacheSizeForTesting();
+    shapeAndReturnWidth("whole run of words");
+    EXPECT_EQ(cacheSize + 1, HarfBuzzShaper::shapeCacheSizeForTesting());
+}
+
+TEST_F(HarfBuzzShaperTest, WordsAreCachedSeparately)
+{
+    RuntimeEnabledFeatures::setShapeTextByWordEnabled(true);
+    size_t cacheSize = HarfBuzzShaper::shapeCacheSizeForTesting();
+    float lineWidth = shapeAndReturnWidth("separate  words");
+    // "separate", "  " and "words".
+    EXPECT_EQ(cacheSize + 3, HarfBuzzShaper::shapeCacheSizeForTesting());
+
+    // Measuring a word of the line on its own hits the cache.
+    float wordWidth = shapeAndReturnWidth("words");
+    EXPECT_EQ(cacheSize + 3, HarfBuzzShaper::shapeCacheSizeForTesting());
+    EXPECT_GT(wordWidth, 0);
+    EXPECT_GT(lineWidth, wordWidth);
+}
+
+TEST_F(HarfBuzzShaperTest, WidthDoesNotDependOnCache)
+{
+    RuntimeEnabledFeatures::setShapeTextByWordEnabled(true);
+    float uncachedWidth = shapeAndReturnWidth("same width twice");
+    float cachedWidth = shapeAndReturnWidth("same width twice");
+    EXPECT_EQ(uncachedWidth, cachedWidth);
+}
+
+TEST_F(HarfBuzzShaperTest, LongWordsAreNotCached)
+{
+    RuntimeEnabledFeatures::setShapeTextByWordEnabled(true);
+    StringBuilder builder;
+    for (unsigned i = 0; i <= 128; ++i)
+        builder.append('x');
+
+    size_t cacheSize = HarfBuzzShaper::shapeCacheSizeForTesting();
+    EXPECT_GT(shapeAndReturnWidth(builder.toString()), 0);
+    EXPECT_EQ(cacheSize, HarfBuzzShaper::shapeCacheSizeForTesting());
+}
+
+} // namespace blink
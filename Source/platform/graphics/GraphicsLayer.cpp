@@ -35,6 +35,7 @@
 #include "platform/graphics/FirstPaintInvalidationTracking.h"
 #include "platform/graphics/GraphicsLayerFactory.h"
 #include "platform/graphics/Image.h"
+#include "platform/graphics/PaintInvalidationRegion.h"
 #include "platform/graphics/filters/SkiaImageFilterBuilder.h"
 #include "platform/graphics/skia/NativeImageSkia.h"
 #include "platform/scroll/ScrollableArea.h"
@@ -75,6 +76,18 @@ static RepaintMap& repaintRectMap()
     return map;
 }
 
+typedef HashMap<GraphicsLayer*, PaintInvalidationRegion> PaintInvalidationRegionMap;
+static PaintInvalidationRegionMap& coalescedPaintInvalidations()
+{
+    DEFINE_STATIC_LOCAL(PaintInvalidationRegionMap, map, ());
+    return map;
+}
+
+static unsigned s_paintInvalidationCoalescingScopeDepth = 0;
+static uint64_t s_requestedAreaAtCoalescingScopeStart = 0;
+static uint64_t s_invalidatedAreaAtCoalescingScopeStart = 0;
+static GraphicsLayer::PaintInvalidationAreaCounters s_paintInvalidationAreaCounters;
+
 PassOwnPtr<GraphicsLayer> GraphicsLayer::create(GraphicsLayerFactory* factory, GraphicsLayerClient* client)
 {
     return factory->createGraphicsLayer(client);
@@ -140,6 +153,7 @@ GraphicsLayer::~GraphicsLayer()
     removeFromParent();
 
     resetTrackedPaintInvalidations();
+    coalescedPaintInvalidations().remove(this);
     ASSERT(!m_parent);
 }
 
@@ -278,6 +292,8 @@ void GraphicsLayer::paintGraphicsLayerContents(GraphicsContext& context, const I
     if (firstPaintInvalidationTrackingEnabled())
         m_debugInfo.clearAnnotatedInvalidateRects();
     incrementPaintCount();
+    s_paintInvalidationAreaCounters.paintedArea += PaintInvalidationRegion::area(clip);
+    TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("blink.invalidation"), "GraphicsLayerPaintedArea", PaintInvalidationRegion::area(clip));
     m_client->paintContents(this, context, m_paintingPhase, clip);
 }
 
@@ -895,6 +911,11 @@ void GraphicsLayer::setNeedsDisplay()
 {
     if (drawsContent()) {
         m_layer->layer()->invalidate();
+        // The whole layer is invalidated, so there's nothing left to coalesce.
+        coalescedPaintInvalidations().remove(this);
+        uint64_t layerArea = PaintInvalidationRegion::area(IntRect(IntPoint(), expandedIntSize(m_size)));
+        s_paintInvalidationAreaCounters.requestedArea += layerArea;
+        s_paintInvalidationAreaCounters.invalidatedArea += layerArea;
         addRepaintRect(FloatRect(FloatPoint(), m_size));
         for (size_t i = 0; i < m_linkHighlights.size(); ++i)
             m_linkHighlights[i]->invalidate();
@@ -904,7 +925,12 @@ void GraphicsLayer::setNeedsDisplay()
 void GraphicsLayer::setNeedsDisplayInRect(const FloatRect& rect, WebInvalidationDebugAnnotations annotations)
 {
     if (drawsContent()) {
-        m_layer->layer()->invalidateRect(rect);
+        IntRect dirtyRect = enclosingIntRect(rect);
+        s_paintInvalidationAreaCounters.requestedArea += PaintInvalidationRegion::area(dirtyRect);
+        if (s_paintInvalidationCoalescingScopeDepth)
+            coalescedPaintInvalidations().add(this, PaintInvalidationRegion()).storedValue->value.unite(dirtyRect);
+        else
+            invalidateContentLayerRect(dirtyRect);
         if (firstPaintInvalidationTrackingEnabled())
             m_debugInfo.appendAnnotatedInvalidateRect(rect, annotations);
         addRepaintRect(rect);
@@ -913,6 +939,65 @@ void GraphicsLayer::setNeedsDisplayInRect(const FloatRect& rect, WebInvalidation
     }
 }
 
+void GraphicsLayer::invalidateContentLayerRect(const IntRect& rect)
+{
+    if (rect.isEmpty())
+        return;
+    m_layer->layer()->invalidateRect(FloatRect(rect));
+    s_paintInvalidationAreaCounters.invalidatedArea += PaintInvalidationRegion::area(rect);
+}
+
+GraphicsLayer::PaintInvalidationCoalescingScope::PaintInvalidationCoalescingScope()
+{
+    if (!s_paintInvalidationCoalescingScopeDepth++) {
+        s_requestedAreaAtCoalescingScopeStart = s_paintInvalidationAreaCounters.requestedArea;
+        s_invalidatedAreaAtCoalescingScopeStart = s_paintInvalidationAreaCounters.invalidatedArea;
+    }
+}
+
+GraphicsLayer::PaintInvalidationCoalescingScope::~PaintInvalidationCoalescingScope()
+{
+    ASSERT(s_paintInvalidationCoalescingScopeDepth);
+    if (!--s_paintInvalidationCoalescingScopeDepth)
+        flushCoalescedPaintInvalidations();
+}
+
+void GraphicsLayer::flushCoalescedPaintInvalidations()
+{
+    PaintInvalidationRegionMap regions;
+    regions.swap(coalescedPaintInvalidations());
+    PaintInvalidationRegionMap::const_iterator end = regions.end();
+    for (PaintInvalidationRegionMap::const_iterator it = regions.begin(); it != end; ++it) {
+        GraphicsLayer* layer = it->key;
+        // The layer may have stopped drawing content since the rects were collected.
+        if (!layer->drawsContent())
+            continue;
+        const Vector<IntRect>& rects = it->value.rects();
+        for (size_t i = 0; i < rects.size(); ++i)
+            layer->invalidateContentLayerRect(rects[i]);
+    }
+
+    uint64_t requestedArea = s_paintInvalidationAreaCounters.requestedArea - s_requestedAreaAtCoalescingScopeStart;
+    if (requestedArea) {
+        TRACE_COUNTER2(TRACE_DISABLED_BY_DEFAULT("blink.invalidation"), "GraphicsLayerInvalidatedArea",
+            "requested", requestedArea, "invalidated", s_paintInvalidationAreaCounters.invalidatedArea - s_invalidatedAreaAtCoalescingScopeStart);
+    }
+}
+
+const GraphicsLayer::PaintInvalidationAreaCounters& GraphicsLayer::paintInvalidationAreaCounters()
+{
+    return s_paintInvalidationAreaCounters;
+}
+
+void GraphicsLayer::resetPaintInvalidationAreaCounters()
+{
+    s_paintInvalidationAreaCounters.requestedArea = 0;
+    s_paintInvalidationAreaCounters.invalidatedArea = 0;
+    s_paintInvalidationAreaCounters.paintedArea = 0;
+    s_requestedAreaAtCoalescingScopeStart = 0;
+    s_invalidatedAreaAtCoalescingScopeStart = 0;
+}
+
 void GraphicsLayer::setContentsRect(const IntRect& rect)
 {
     if (rect == m_contentsRect)
@@ -185,6 +185,28 @@ public:
     // mark the given rect (in layer coords) as needing dispay. Never goes deep.
     void setNeedsDisplayInRect(const FloatRect&, WebInvalidationDebugAnnotations);
 
+    // While a PaintInvalidationCoalescingScope is alive, the rects passed to setNeedsDisplayInRect()
+    // are collected in a PaintInvalidationRegion per layer and passed to the compositor when the
+    // outermost scope goes away.
+    class PLATFORM_EXPORT PaintInvalidationCoalescingScope {
+        WTF_MAKE_NONCOPYABLE(PaintInvalidationCoalescingScope);
+    public:
+        PaintInvalidationCoalescingScope();
+        ~PaintInvalidationCoalescingScope();
+    };
+
+    // Areas in layer pixels, accumulated over all layers since the last reset.
+    struct PaintInvalidationAreaCounters {
+        // The area of the rects passed to setNeedsDisplay() and setNeedsDisplayInRect().
+        uint64_t requestedArea;
+        // The area of the rects passed to the compositor after coalescing.
+        uint64_t invalidatedArea;
+        // The area of the clip rects the compositor asked us to paint.
+        uint64_t paintedArea;
+    };
+    static const PaintInvalidationAreaCounters& paintInvalidationAreaCounters();
+    static void resetPaintInvalidationAreaCounters();
+
     void setContentsNeedsDisplay();
 
     // Set that the position/size of the contents (image or video).
@@ -268,6 +290,9 @@ private:
 
     void incrementPaintCount() { ++m_paintCount; }
 
+    static void flushCoalescedPaintInvalidations();
+    void invalidateContentLayerRect(const IntRect&);
+
     // Helper functions used by settors to keep layer's the state consistent.
     void updateChildList();
     void updateLayerIsDrawable();
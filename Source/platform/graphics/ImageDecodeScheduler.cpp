@@ -0,0 +1,151 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "platform/graphics/ImageDecodeScheduler.h"
+
+#include "SkPixelRef.h"
+#include "platform/ParallelWorkerPool.h"
+#include "platform/Task.h"
+#include "platform/TraceEvent.h"
+#include "platform/graphics/DeferredImageDecoder.h"
+#include "platform/graphics/Image.h"
+#include "platform/graphics/skia/NativeImageSkia.h"
+#include "public/platform/Platform.h"
+#include "wtf/CurrentTime.h"
+#include "wtf/MainThread.h"
+#include "wtf/Threading.h"
+#include <algorithm>
+
+namespace blink {
+
+// Decoding more images at once than this would mostly compete with rasterization.
+static const size_t maximumRunningTaskCount = 4;
+
+ImageDecodeScheduler::DecodeRequest::DecodeRequest()
+    : distanceFromViewport(0)
+    , scheduleTime(0)
+    , sequenceNumber(0)
+{
+}
+
+ImageDecodeScheduler::DecodeRequest::DecodeRequest(const SkBitmap& bitmap, float distanceFromViewport, double scheduleTime, unsigned sequenceNumber)
+    : bitmap(bitmap)
+    , distanceFromViewport(distanceFromViewport)
+    , scheduleTime(scheduleTime)
+    , sequenceNumber(sequenceNumber)
+{
+}
+
+bool ImageDecodeScheduler::isDecodedAfter(const DecodeRequest& a, const DecodeRequest& b)
+{
+    if (a.distanceFromViewport != b.distanceFromViewport)
+        return a.distanceFromViewport > b.distanceFromViewport;
+    return a.sequenceNumber > b.sequenceNumber;
+}
+
+ImageDecodeScheduler& ImageDecodeScheduler::instance()
+{
+    AtomicallyInitializedStatic(ImageDecodeScheduler&, scheduler = *new ImageDecodeScheduler);
+    return scheduler;
+}
+
+ImageDecodeScheduler::ImageDecodeScheduler()
+    : m_nextSequenceNumber(0)
+    , m_runningTaskCount(0)
+{
+}
+
+bool ImageDecodeScheduler::scheduleDecode(Image* image, float distanceFromViewport)
+{
+    ASSERT(isMainThread());
+    if (!image || !image->isBitmapImage() || image->maybeAnimated())
+        return false;
+
+    // Without worker threads the image is best decoded when it is painted.
+    if (!workerThreadCount())
+        return false;
+
+    RefPtr<NativeImageSkia> nativeImage = image->nativeImageForCurrentFrame();
+    if (!nativeImage || !DeferredImageDecoder::isLazyDecoded(nativeImage->bitmap()))
+        return false;
+
+    enqueueDecode(nativeImage->bitmap(), distanceFromViewport);
+    return true;
+}
+
+void ImageDecodeScheduler::enqueueDecode(const SkBitmap& bitmap, float distanceFromViewport)
+{
+    MutexLocker locker(m_mutex);
+    HashMap<uint32_t, float>::AddResult result = m_pendingDistances.add(bitmap.getGenerationID(), distanceFromViewport);
+    if (!result.isNewEntry) {
+        if (result.storedValue->value <= distanceFromViewport)
+            return;
+        // The request already in the heap is skipped when it comes up, see takeNextRequest().
+        result.storedValue->value = distanceFromViewport;
+    }
+    m_requestHeap.append(DecodeRequest(bitmap, distanceFromViewport, monotonicallyIncreasingTime(), m_nextSequenceNumber++));
+    std::push_heap(m_requestHeap.begin(), m_requestHeap.end(), isDecodedAfter);
+    TRACE_COUNTER1("blink", "PendingImageDecodes", m_pendingDistances.size());
+
+    if (m_runningTaskCount < std::min(workerThreadCount(), maximumRunningTaskCount)) {
+        ++m_runningTaskCount;
+        postDecodeTask();
+    }
+}
+
+bool ImageDecodeScheduler::takeNextRequest(DecodeRequest& request)
+{
+    MutexLocker locker(m_mutex);
+    while (!m_requestHeap.isEmpty()) {
+        std::pop_heap(m_requestHeap.begin(), m_requestHeap.end(), isDecodedAfter);
+        request = m_requestHeap.last();
+        m_requestHeap.removeLast();
+
+        HashMap<uint32_t, float>::iterator it = m_pendingDistances.find(request.bitmap.getGenerationID());
+        if (it == m_pendingDistances.end() || it->value != request.distanceFromViewport)
+            continue;
+        m_pendingDistances.remove(it);
+        TRACE_COUNTER1("blink", "PendingImageDecodes", m_pendingDistances.size());
+        return true;
+    }
+    ASSERT(m_runningTaskCount);
+    --m_runningTaskCount;
+    return false;
+}
+
+size_t ImageDecodeScheduler::workerThreadCount() const
+{
+    return ParallelWorkerPool::shared().maximumParallelism() - 1;
+}
+
+void ImageDecodeScheduler::postDecodeTask()
+{
+    ParallelWorkerPool::shared().postTask(new Task(WTF::bind(&ImageDecodeScheduler::runPendingDecodes, this)));
+}
+
+void ImageDecodeScheduler::runPendingDecodes()
+{
+    DecodeRequest request;
+    while (takeNextRequest(request))
+        decode(request);
+}
+
+void ImageDecodeScheduler::decode(const DecodeRequest& request)
+{
+    double startTime = monotonicallyIncreasingTime();
+    TRACE_EVENT2("blink", "ImageDecodeScheduler::decode", "generationId", request.bitmap.getGenerationID(), "distanceFromViewport", request.distanceFromViewport);
+
+    // Locking the pixels of a lazily decoded bitmap decodes them into discardable memory that
+    // stays around after unlocking.
+    SkBitmap bitmap(request.bitmap);
+    bitmap.lockPixels();
+    bitmap.unlockPixels();
+
+    double endTime = monotonicallyIncreasingTime();
+    Platform::current()->histogramCustomCounts("Blink.ImageDecodeScheduler.QueueTime", static_cast<int>((startTime - request.scheduleTime) * 1000), 0, 10 * 1000, 50);
+    Platform::current()->histogramCustomCounts("Blink.ImageDecodeScheduler.DecodeLatency", static_cast<int>((endTime - request.scheduleTime) * 1000), 0, 10 * 1000, 50);
+}
+
+} // namespace blink
@@ -0,0 +1,84 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef ImageDecodeScheduler_h
+#define ImageDecodeScheduler_h
+
+#include "SkBitmap.h"
+#include "platform/PlatformExport.h"
+#include "wtf/HashMap.h"
+#include "wtf/Noncopyable.h"
+#include "wtf/ThreadingPrimitives.h"
+#include "wtf/Vector.h"
+
+namespace blink {
+
+class Image;
+
+// Decodes lazily decoded images ahead of painting, several at a time on the threads of the
+// ParallelWorkerPool. The pixels are decoded into the discardable memory of the image's
+// SkDiscardablePixelRef, where rasterization finds them as long as they haven't been purged.
+// Decoding goes through ImageFrameGenerator, so an image that has only partially been received
+// leaves its decoder in the ImageDecodingStore and later decodes resume from it.
+//
+// Images are decoded in order of their distance to the viewport, nearest first. Scheduling an
+// image that is already waiting to be decoded only moves it closer to the front.
+//
+// THREAD SAFETY
+//
+// scheduleDecode() must be called on the main thread.
+class PLATFORM_EXPORT ImageDecodeScheduler {
+    WTF_MAKE_NONCOPYABLE(ImageDecodeScheduler);
+public:
+    static ImageDecodeScheduler& instance();
+
+    // Schedules a decode of the current frame of the image if it is lazily decoded and not
+    // animated. Returns true if the image will be decoded.
+    bool scheduleDecode(Image*, float distanceFromViewport);
+
+protected:
+    struct DecodeRequest {
+        DecodeRequest();
+        DecodeRequest(const SkBitmap&, float distanceFromViewport, double scheduleTime, unsigned sequenceNumber);
+
+        SkBitmap bitmap;
+        float distanceFromViewport;
+        double scheduleTime;
+        unsigned sequenceNumber;
+    };
+
+    ImageDecodeScheduler();
+    virtual ~ImageDecodeScheduler() { }
+
+    // Queues a decode of a lazily decoded bitmap, and starts another worker task unless the
+    // maximum number of tasks is already running.
+    void enqueueDecode(const SkBitmap&, float distanceFromViewport);
+
+    // Pops the next request that hasn't been superseded by a nearer one. When there is none,
+    // the calling worker task stops counting as running.
+    bool takeNextRequest(DecodeRequest&);
+
+    // Virtual for testing.
+    virtual size_t workerThreadCount() const;
+    virtual void postDecodeTask();
+
+private:
+    // Orders a heap of DecodeRequests so that the nearest, then the earliest, request is on top.
+    static bool isDecodedAfter(const DecodeRequest&, const DecodeRequest&);
+
+    void runPendingDecodes();
+    void decode(const DecodeRequest&);
+
+    // Protects all members below.
+    Mutex m_mutex;
+    Vector<DecodeRequest> m_requestHeap;
+    // Maps the generation ID of each pending bitmap to its nearest requested distance.
+    HashMap<uint32_t, float> m_pendingDistances;
+    unsigned m_nextSequenceNumber;
+    size_t m_runningTaskCount;
+};
+
+} // namespace blink
+
+#endif // ImageDecodeScheduler_h
@@ -31,6 +31,8 @@
 #include "platform/TraceEvent.h"
 #include "platform/graphics/ImageDecodingStore.h"
 #include "platform/image-decoders/ImageDecoder.h"
+#include "public/platform/Platform.h"
+#include "wtf/CurrentTime.h"
 
 #include "skia/ext/image_operations.h"
 #include "third_party/skia/include/core/SkMallocPixelRef.h"
@@ -89,7 +91,6 @@ ImageFrameGenerator::ImageFrameGenerator(const SkISize& fullSize, PassRefPtr<Sha
     : m_fullSize(fullSize)
     , m_isMultiFrame(isMultiFrame)
     , m_decodeFailedAndEmpty(false)
-    , m_decodeCount(0)
 {
     setData(data.get(), allDataReceived);
 }
@@ -126,11 +127,13 @@ bool ImageFrameGenerator::decodeAndScale(const SkImageInfo& info, size_t index,
     if (m_decodeFailedAndEmpty)
         return false;
 
-    TRACE_EVENT2("blink", "ImageFrameGenerator::decodeAndScale", "generator", this, "decodeCount", m_decodeCount);
+    TRACE_EVENT2("blink", "ImageFrameGenerator::decodeAndScale", "generator", this, "decodeCount", decodeStatistics().decodeCount);
 
     m_externalAllocator = adoptPtr(new ExternalMemoryAllocator(info, pixels, rowBytes));
 
+    double startTime = monotonicallyIncreasingTime();
     SkBitmap bitmap = tryToResumeDecode(scaledSize, index);
+    didDecode(monotonicallyIncreasingTime() - startTime);
     if (bitmap.isNull())
         return false;
 
@@ -159,7 +162,7 @@ bool ImageFrameGenerator::decodeToYUV(SkISize componentSizes[3], void* planes[3]
     if (m_decodeFailedAndEmpty)
         return false;
 
-    TRACE_EVENT2("blink", "ImageFrameGenerator::decodeToYUV", "generator", this, "decodeCount", static_cast<int>(m_decodeCount));
+    TRACE_EVENT2("blink", "ImageFrameGenerator::decodeToYUV", "generator", this, "decodeCount", decodeStatistics().decodeCount);
 
     if (!planes || !planes[0] || !planes[1] || !planes[2]
         || !rowBytes || !rowBytes[0] || !rowBytes[1] || !rowBytes[2]) {
@@ -185,7 +188,9 @@ bool ImageFrameGenerator::decodeToYUV(SkISize componentSizes[3], void* planes[3]
     bool sizeUpdated = updateYUVComponentSizes(decoder.get(), componentSizes, ImageDecoder::ActualSize);
     RELEASE_ASSERT(sizeUpdated);
 
+    double startTime = monotonicallyIncreasingTime();
     bool yuvDecoded = decoder->decodeToYUV();
+    didDecode(monotonicallyIncreasingTime() - startTime);
     if (yuvDecoded)
         setHasAlpha(0, false); // YUV is always opaque
     return yuvDecoded;
@@ -250,6 +255,23 @@ void ImageFrameGenerator::setHasAlpha(size_t index, bool hasAlpha)
     m_hasAlpha[index] = hasAlpha;
 }
 
+void ImageFrameGenerator::didDecode(double duration)
+{
+    {
+        MutexLocker lock(m_statisticsMutex);
+        ++m_decodeStatistics.decodeCount;
+        m_decodeStatistics.lastDecodeDuration = duration;
+        m_decodeStatistics.totalDecodeDuration += duration;
+    }
+    Platform::current()->histogramCustomCounts("Blink.ImageDecode.DecodeTime", static_cast<int>(duration * 1000), 0, 10 * 1000, 50);
+}
+
+ImageFrameGenerator::DecodeStatistics ImageFrameGenerator::decodeStatistics()
+{
+    MutexLocker lock(m_statisticsMutex);
+    return m_decodeStatistics;
+}
+
 bool ImageFrameGenerator::decode(size_t index, ImageDecoder** decoder, SkBitmap* bitmap)
 {
     TRACE_EVENT2("blink", "ImageFrameGenerator::decode", "width", m_fullSize.width(), "height", m_fullSize.height());
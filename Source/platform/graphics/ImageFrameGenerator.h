@@ -88,6 +88,22 @@ public:
 
     bool getYUVComponentSizes(SkISize componentSizes[3]);
 
+    // Timings of the decodes done for this image, in seconds. A decode that resumes a partially
+    // decoded image only counts the time spent on the new data.
+    struct DecodeStatistics {
+        DecodeStatistics()
+            : decodeCount(0)
+            , lastDecodeDuration(0)
+            , totalDecodeDuration(0)
+        {
+        }
+
+        int decodeCount;
+        double lastDecodeDuration;
+        double totalDecodeDuration;
+    };
+    DecodeStatistics decodeStatistics();
+
 private:
     class ExternalMemoryAllocator;
     friend class ImageFrameGeneratorTest;
@@ -96,6 +112,7 @@ private:
     void setImageDecoderFactory(PassOwnPtr<ImageDecoderFactory> factory) { m_imageDecoderFactory = factory; }
 
     void setHasAlpha(size_t index, bool hasAlpha);
+    void didDecode(double duration);
 
     // These methods are called while m_decodeMutex is locked.
     SkBitmap tryToResumeDecode(const SkISize& scaledSize, size_t index);
@@ -109,7 +126,7 @@ private:
     bool m_isMultiFrame;
     bool m_decodeFailedAndEmpty;
     Vector<bool> m_hasAlpha;
-    int m_decodeCount;
+    DecodeStatistics m_decodeStatistics;
     OwnPtr<ExternalMemoryAllocator> m_externalAllocator;
 
     OwnPtr<ImageDecoderFactory> m_imageDecoderFactory;
@@ -119,6 +136,9 @@ private:
 
     // Protect concurrent access to m_hasAlpha.
     Mutex m_alphaMutex;
+
+    // Protect concurrent access to m_decodeStatistics.
+    Mutex m_statisticsMutex;
 };
 
 } // namespace blink
@@ -195,4 +195,22 @@ TEST_F(ImageFrameGeneratorTest, frameHasAlpha)
     EXPECT_FALSE(m_generator->hasAlpha(1));
 }
 
+TEST_F(ImageFrameGeneratorTest, decodeStatistics)
+{
+    EXPECT_EQ(0, m_generator->decodeStatistics().decodeCount);
+
+    setFrameStatus(ImageFrame::FramePartial);
+    char buffer[100 * 100 * 4];
+    m_generator->decodeAndScale(imageInfo(), 0, buffer, 100 * 4);
+    EXPECT_EQ(1, m_generator->decodeStatistics().decodeCount);
+
+    setFrameStatus(ImageFrame::FrameComplete);
+    addNewData();
+    m_generator->decodeAndScale(imageInfo(), 0, buffer, 100 * 4);
+    ImageFrameGenerator::DecodeStatistics statistics = m_generator->decodeStatistics();
+    EXPECT_EQ(2, statistics.decodeCount);
+    EXPECT_GE(statistics.totalDecodeDuration, statistics.lastDecodeDuration);
+    EXPECT_GE(statistics.lastDecodeDuration, 0);
+}
+
 } // namespace blink
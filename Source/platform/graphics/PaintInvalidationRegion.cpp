@@ -0,0 +1,103 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "platform/graphics/PaintInvalidationRegion.h"
+
+namespace blink {
+
+static const size_t defaultMaxRectCount = 8;
+static const float defaultMaxWastedAreaRatio = 0.25f;
+
+static size_t s_maxRectCount = defaultMaxRectCount;
+static float s_maxWastedAreaRatio = defaultMaxWastedAreaRatio;
+
+size_t PaintInvalidationRegion::maxRectCount()
+{
+    return s_maxRectCount;
+}
+
+float PaintInvalidationRegion::maxWastedAreaRatio()
+{
+    return s_maxWastedAreaRatio;
+}
+
+void PaintInvalidationRegion::setLimits(size_t maxRectCount, float maxWastedAreaRatio)
+{
+    ASSERT(maxRectCount);
+    ASSERT(maxWastedAreaRatio >= 0 && maxWastedAreaRatio <= 1);
+    s_maxRectCount = maxRectCount;
+    s_maxWastedAreaRatio = maxWastedAreaRatio;
+}
+
+void PaintInvalidationRegion::resetLimits()
+{
+    setLimits(defaultMaxRectCount, defaultMaxWastedAreaRatio);
+}
+
+// Returns the area of unionRect(a, b) that is covered by neither a nor b.
+static uint64_t wastedAreaOfUnion(const IntRect& a, const IntRect& b)
+{
+    uint64_t coveredArea = PaintInvalidationRegion::area(a) + PaintInvalidationRegion::area(b) - PaintInvalidationRegion::area(intersection(a, b));
+    return PaintInvalidationRegion::area(unionRect(a, b)) - coveredArea;
+}
+
+static bool shouldMerge(const IntRect& a, const IntRect& b)
+{
+    return wastedAreaOfUnion(a, b) <= PaintInvalidationRegion::maxWastedAreaRatio() * PaintInvalidationRegion::area(unionRect(a, b));
+}
+
+void PaintInvalidationRegion::unite(const IntRect& rect)
+{
+    if (rect.isEmpty())
+        return;
+
+    IntRect newRect = rect;
+    size_t i = 0;
+    while (i < m_rects.size()) {
+        if (m_rects[i].contains(newRect))
+            return;
+        if (shouldMerge(m_rects[i], newRect)) {
+            newRect.unite(m_rects[i]);
+            m_rects.remove(i);
+            // The grown rect may now cover or merge with rects we have already looked at.
+            i = 0;
+            continue;
+        }
+        ++i;
+    }
+    m_rects.append(newRect);
+
+    if (m_rects.size() <= s_maxRectCount)
+        return;
+
+    // Over budget, so merge the pair of rects whose union wastes the least area.
+    size_t mergeIndex1 = 0;
+    size_t mergeIndex2 = 1;
+    uint64_t leastWastedArea = wastedAreaOfUnion(m_rects[0], m_rects[1]);
+    for (size_t i = 0; i < m_rects.size(); ++i) {
+        for (size_t j = i + 1; j < m_rects.size(); ++j) {
+            uint64_t wastedArea = wastedAreaOfUnion(m_rects[i], m_rects[j]);
+            if (wastedArea < leastWastedArea) {
+                leastWastedArea = wastedArea;
+                mergeIndex1 = i;
+                mergeIndex2 = j;
+            }
+        }
+    }
+    IntRect mergedRect = unionRect(m_rects[mergeIndex1], m_rects[mergeIndex2]);
+    m_rects.remove(mergeIndex2);
+    m_rects.remove(mergeIndex1);
+    unite(mergedRect);
+}
+
+uint64_t PaintInvalidationRegion::totalArea() const
+{
+    uint64_t totalArea = 0;
+    for (size_t i = 0; i < m_rects.size(); ++i)
+        totalArea += area(m_rects[i]);
+    return totalArea;
+}
+
+} // namespace blink
@@ -0,0 +1,42 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PaintInvalidationRegion_h
+#define PaintInvalidationRegion_h
+
+#include "platform/PlatformExport.h"
+#include "platform/geometry/IntRect.h"
+#include "wtf/Vector.h"
+
+namespace blink {
+
+// A small set of rects covering the paint invalidations of a layer. Unlike Region this isn't
+// exact: a new rect is merged with an existing one whenever their union doesn't waste more
+// than maxWastedAreaRatio() of its area on pixels that weren't invalidated, and the two
+// cheapest rects to merge are merged whenever there are more than maxRectCount() rects.
+class PLATFORM_EXPORT PaintInvalidationRegion {
+public:
+    PaintInvalidationRegion() { }
+
+    void unite(const IntRect&);
+    void clear() { m_rects.clear(); }
+
+    bool isEmpty() const { return m_rects.isEmpty(); }
+    const Vector<IntRect>& rects() const { return m_rects; }
+    uint64_t totalArea() const;
+
+    static uint64_t area(const IntRect& rect) { return static_cast<uint64_t>(rect.width()) * rect.height(); }
+
+    static size_t maxRectCount();
+    static float maxWastedAreaRatio();
+    static void setLimits(size_t maxRectCount, float maxWastedAreaRatio);
+    static void resetLimits();
+
+private:
+    Vector<IntRect> m_rects;
+};
+
+} // namespace blink
+
+#endif // PaintInvalidationRegion_h
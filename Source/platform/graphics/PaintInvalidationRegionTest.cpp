@@ -0,0 +1,100 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "platform/graphics/PaintInvalidationRegion.h"
+
+#include <gtest/gtest.h>
+
+using namespace blink;
+
+namespace {
+
+class PaintInvalidationRegionTest : public ::testing::Test {
+protected:
+    virtual void TearDown() OVERRIDE
+    {
+        PaintInvalidationRegion::resetLimits();
+    }
+};
+
+TEST_F(PaintInvalidationRegionTest, IgnoresEmptyAndContainedRects)
+{
+    PaintInvalidationRegion region;
+    region.unite(IntRect());
+    EXPECT_TRUE(region.isEmpty());
+
+    region.unite(IntRect(0, 0, 100, 100));
+    region.unite(IntRect(10, 10, 20, 20));
+    ASSERT_EQ(1u, region.rects().size());
+    EXPECT_EQ(IntRect(0, 0, 100, 100), region.rects()[0]);
+
+    region.unite(IntRect(-10, -10, 200, 200));
+    ASSERT_EQ(1u, region.rects().size());
+    EXPECT_EQ(IntRect(-10, -10, 200, 200), region.rects()[0]);
+}
+
+TEST_F(PaintInvalidationRegionTest, MergesRectsThatWasteLittleArea)
+{
+    PaintInvalidationRegion region;
+    region.unite(IntRect(0, 0, 100, 10));
+    region.unite(IntRect(0, 10, 100, 10));
+    ASSERT_EQ(1u, region.rects().size());
+    EXPECT_EQ(IntRect(0, 0, 100, 20), region.rects()[0]);
+    EXPECT_EQ(2000u, region.totalArea());
+}
+
+TEST_F(PaintInvalidationRegionTest, KeepsDistantRectsSeparate)
+{
+    PaintInvalidationRegion region;
+    region.unite(IntRect(0, 0, 10, 10));
+    region.unite(IntRect(500, 500, 10, 10));
+    EXPECT_EQ(2u, region.rects().size());
+    EXPECT_EQ(200u, region.totalArea());
+}
+
+TEST_F(PaintInvalidationRegionTest, MergesGrownRectWithEarlierRects)
+{
+    PaintInvalidationRegion region;
+    region.unite(IntRect(0, 0, 10, 10));
+    region.unite(IntRect(40, 0, 10, 10));
+    EXPECT_EQ(2u, region.rects().size());
+
+    // Fills the gap, after which all three rects merge into one.
+    region.unite(IntRect(10, 0, 30, 10));
+    ASSERT_EQ(1u, region.rects().size());
+    EXPECT_EQ(IntRect(0, 0, 50, 10), region.rects()[0]);
+}
+
+TEST_F(PaintInvalidationRegionTest, MergesCheapestPairWhenOverBudget)
+{
+    PaintInvalidationRegion::setLimits(2, 0);
+
+    PaintInvalidationRegion region;
+    region.unite(IntRect(0, 0, 10, 10));
+    region.unite(IntRect(1000, 0, 10, 10));
+    region.unite(IntRect(0, 20, 10, 10));
+    ASSERT_EQ(2u, region.rects().size());
+    EXPECT_EQ(IntRect(1000, 0, 10, 10), region.rects()[0]);
+    EXPECT_EQ(IntRect(0, 0, 10, 30), region.rects()[1]);
+}
+
+TEST_F(PaintInvalidationRegionTest, WastedAreaRatioLimitsMerging)
+{
+    PaintInvalidationRegion::setLimits(8, 0.5f);
+
+    // The union of these is 30x10, of which 10x10 isn't invalidated.
+    PaintInvalidationRegion region;
+    region.unite(IntRect(0, 0, 10, 10));
+    region.unite(IntRect(20, 0, 10, 10));
+    EXPECT_EQ(1u, region.rects().size());
+
+    PaintInvalidationRegion::setLimits(8, 0.25f);
+    region.clear();
+    region.unite(IntRect(0, 0, 10, 10));
+    region.unite(IntRect(20, 0, 10, 10));
+    EXPECT_EQ(2u, region.rects().size());
+}
+
+} // namespace
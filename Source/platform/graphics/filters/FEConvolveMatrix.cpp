@@ -26,7 +26,7 @@
 #include "platform/graphics/filters/FEConvolveMatrix.h"
 
 #include "SkMatrixConvolutionImageFilter.h"
-#include "platform/graphics/filters/ParallelJobs.h"
+#include "platform/ParallelWorkerPool.h"
 #include "platform/graphics/filters/SkiaImageFilterBuilder.h"
 #include "platform/text/TextStream.h"
 #include "wtf/OwnPtr.h"
@@ -419,9 +419,9 @@ ALWAYS_INLINE void FEConvolveMatrix::setOuterPixels(PaintingData& paintingData,
         fastSetOuterPixels<false>(paintingData, x1, y1, x2, y2);
 }
 
-void FEConvolveMatrix::setInteriorPixelsWorker(InteriorPixelParameters* param)
+void FEConvolveMatrix::setInteriorPixelsWorker(InteriorPixelParameters* param, size_t yStart, size_t yEnd)
 {
-    param->filter->setInteriorPixels(*param->paintingData, param->clipRight, param->clipBottom, param->yStart, param->yEnd);
+    param->filter->setInteriorPixels(*param->paintingData, param->clipRight, param->clipBottom, yStart, yEnd);
 }
 
 void FEConvolveMatrix::applySoftware()
@@ -458,33 +458,16 @@ void FEConvolveMatrix::applySoftware()
 
     if (clipRight >= 0 && clipBottom >= 0) {
 
-        int optimalThreadNumber = (absolutePaintRect().width() * absolutePaintRect().height()) / s_minimalRectDimension;
-        if (optimalThreadNumber > 1) {
-            ParallelJobs<InteriorPixelParameters> parallelJobs(&FEConvolveMatrix::setInteriorPixelsWorker, optimalThreadNumber);
-            const int numOfThreads = parallelJobs.numberOfJobs();
-
-            // Split the job into "heightPerThread" jobs but there a few jobs that need to be slightly larger since
-            // heightPerThread * jobs < total size. These extras are handled by the remainder "jobsWithExtra".
-            const int heightPerThread = clipBottom / numOfThreads;
-            const int jobsWithExtra = clipBottom % numOfThreads;
-
-            int startY = 0;
-            for (int job = 0; job < numOfThreads; ++job) {
-                InteriorPixelParameters& param = parallelJobs.parameter(job);
-                param.filter = this;
-                param.paintingData = &paintingData;
-                param.clipRight = clipRight;
-                param.clipBottom = clipBottom;
-                param.yStart = startY;
-                startY += job < jobsWithExtra ? heightPerThread + 1 : heightPerThread;
-                param.yEnd = startY;
-            }
+        InteriorPixelParameters param;
+        param.filter = this;
+        param.paintingData = &paintingData;
+        param.clipRight = clipRight;
+        param.clipBottom = clipBottom;
 
-            parallelJobs.execute();
-        } else {
-            // Fallback to single threaded mode.
-            setInteriorPixels(paintingData, clipRight, clipBottom, 0, clipBottom);
-        }
+        // The interior rows are convolved in chunks of about s_minimalRectDimension pixels,
+        // which the shared worker pool spreads over its threads.
+        int rowsPerChunk = std::max(1, s_minimalRectDimension / paintSize.width());
+        parallelFor(clipBottom, rowsPerChunk, &FEConvolveMatrix::setInteriorPixelsWorker, &param);
 
         clipRight += m_targetOffset.x() + 1;
         clipBottom += m_targetOffset.y() + 1;
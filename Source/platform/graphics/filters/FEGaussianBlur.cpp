@@ -29,7 +29,6 @@
 
 #include "platform/graphics/GraphicsContext.h"
 #include "platform/graphics/cpu/arm/filters/FEGaussianBlurNEON.h"
-#include "platform/graphics/filters/ParallelJobs.h"
 #include "platform/graphics/filters/SkiaImageFilterBuilder.h"
 #include "platform/text/TextStream.h"
 #include "wtf/MathExtras.h"
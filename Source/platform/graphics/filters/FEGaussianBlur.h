@@ -46,21 +46,6 @@ public:
     virtual TextStream& externalRepresentation(TextStream&, int indention) const OVERRIDE;
 
 private:
-    static const int s_minimalRectDimension = 100 * 100; // Empirical data limit for parallel jobs
-
-    template<typename Type>
-    friend class ParallelJobs;
-
-    struct PlatformApplyParameters {
-        FEGaussianBlur* filter;
-        RefPtr<Uint8ClampedArray> srcPixelArray;
-        RefPtr<Uint8ClampedArray> dstPixelArray;
-        int width;
-        int height;
-        unsigned kernelSizeX;
-        unsigned kernelSizeY;
-    };
-
     FEGaussianBlur(Filter*, float, float);
 
     virtual void applySoftware() OVERRIDE;
@@ -29,8 +29,8 @@
 #include "platform/graphics/filters/FELighting.h"
 
 #include "SkLightingImageFilter.h"
+#include "platform/ParallelWorkerPool.h"
 #include "platform/graphics/filters/DistantLightSource.h"
-#include "platform/graphics/filters/ParallelJobs.h"
 #include "platform/graphics/filters/SkiaImageFilterBuilder.h"
 #include "platform/graphics/skia/NativeImageSkia.h"
 
@@ -252,43 +252,25 @@ inline void FELighting::platformApplyGenericPaint(LightingData& data, LightSourc
     }
 }
 
-void FELighting::platformApplyGenericWorker(PlatformApplyGenericParameters* parameters)
+void FELighting::platformApplyGenericWorker(PlatformApplyGenericParameters* parameters, size_t begin, size_t end)
 {
-    parameters->filter->platformApplyGenericPaint(parameters->data, parameters->paintingData, parameters->yStart, parameters->yEnd);
+    // The light source updates the painting data for every pixel, so each chunk needs its own copy.
+    LightSource::PaintingData paintingData = parameters->paintingData;
+    // The ranges count interior rows, which start at row 1.
+    parameters->filter->platformApplyGenericPaint(parameters->data, paintingData, begin + 1, end + 1);
 }
 
 inline void FELighting::platformApplyGeneric(LightingData& data, LightSource::PaintingData& paintingData)
 {
-    int optimalThreadNumber = ((data.widthDecreasedByOne - 1) * (data.heightDecreasedByOne - 1)) / s_minimalRectDimension;
-    if (optimalThreadNumber > 1) {
-        // Initialize parallel jobs
-        ParallelJobs<PlatformApplyGenericParameters> parallelJobs(&platformApplyGenericWorker, optimalThreadNumber);
-
-        // Fill the parameter array
-        int job = parallelJobs.numberOfJobs();
-        if (job > 1) {
-            // Split the job into "yStep"-sized jobs but there a few jobs that need to be slightly larger since
-            // yStep * jobs < total size. These extras are handled by the remainder "jobsWithExtra".
-            const int yStep = (data.heightDecreasedByOne - 1) / job;
-            const int jobsWithExtra = (data.heightDecreasedByOne - 1) % job;
-
-            int yStart = 1;
-            for (--job; job >= 0; --job) {
-                PlatformApplyGenericParameters& params = parallelJobs.parameter(job);
-                params.filter = this;
-                params.data = data;
-                params.paintingData = paintingData;
-                params.yStart = yStart;
-                yStart += job < jobsWithExtra ? yStep + 1 : yStep;
-                params.yEnd = yStart;
-            }
-            parallelJobs.execute();
-            return;
-        }
-        // Fallback to single threaded mode.
-    }
-
-    platformApplyGenericPaint(data, paintingData, 1, data.heightDecreasedByOne);
+    PlatformApplyGenericParameters parameters;
+    parameters.filter = this;
+    parameters.data = data;
+    parameters.paintingData = paintingData;
+
+    // The interior rows are painted in chunks of about s_minimalRectDimension pixels, which the
+    // shared worker pool spreads over its threads.
+    int rowsPerChunk = std::max(1, s_minimalRectDimension / (data.widthDecreasedByOne - 1));
+    parallelFor(data.heightDecreasedByOne - 1, rowsPerChunk, &platformApplyGenericWorker, &parameters);
 }
 
 inline void FELighting::platformApply(LightingData& data, LightSource::PaintingData& paintingData)
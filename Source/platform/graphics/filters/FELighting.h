@@ -72,21 +72,16 @@ protected:
         inline void bottomRight(int offset, IntPoint& normalVector);
     };
 
-    template<typename Type>
-    friend class ParallelJobs;
-
     struct PlatformApplyGenericParameters {
         FELighting* filter;
         LightingData data;
         LightSource::PaintingData paintingData;
-        int yStart;
-        int yEnd;
     };
 
     virtual FloatRect mapPaintRect(const FloatRect&, bool forward = true) OVERRIDE FINAL;
     virtual bool affectsTransparentPixels() OVERRIDE { return true; }
 
-    static void platformApplyGenericWorker(PlatformApplyGenericParameters*);
+    static void platformApplyGenericWorker(PlatformApplyGenericParameters*, size_t begin, size_t end);
 
     FELighting(Filter*, LightingType, const Color&, float, float, float, float, float, float, PassRefPtr<LightSource>);
 
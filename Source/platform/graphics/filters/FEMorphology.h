@@ -61,15 +61,6 @@ public:
         int radiusY;
     };
 
-    static const int s_minimalArea = (300 * 300); // Empirical data limit for parallel jobs
-
-    struct PlatformApplyParameters {
-        FEMorphology* filter;
-        int startY;
-        int endY;
-        PaintingData* paintingData;
-    };
-
 private:
     FEMorphology(Filter*, MorphologyOperatorType, float radiusX, float radiusY);
 
@@ -28,7 +28,7 @@
 
 #include "SkPerlinNoiseShader.h"
 #include "SkRectShaderImageFilter.h"
-#include "platform/graphics/filters/ParallelJobs.h"
+#include "platform/ParallelWorkerPool.h"
 #include "platform/graphics/filters/SkiaImageFilterBuilder.h"
 #include "platform/text/TextStream.h"
 #include "wtf/MathExtras.h"
@@ -346,9 +346,9 @@ inline void FETurbulence::fillRegion(Uint8ClampedArray* pixelArray, PaintingData
     }
 }
 
-void FETurbulence::fillRegionWorker(FillRegionParameters* parameters)
+void FETurbulence::fillRegionWorker(FillRegionParameters* parameters, size_t startY, size_t endY)
 {
-    parameters->filter->fillRegion(parameters->pixelArray, *parameters->paintingData, parameters->startY, parameters->endY, parameters->baseFrequencyX, parameters->baseFrequencyY);
+    parameters->filter->fillRegion(parameters->pixelArray, *parameters->paintingData, startY, endY, parameters->baseFrequencyX, parameters->baseFrequencyY);
 }
 
 void FETurbulence::applySoftware()
@@ -365,40 +365,17 @@ void FETurbulence::applySoftware()
     PaintingData paintingData(m_seed, roundedIntSize(filterPrimitiveSubregion().size()));
     initPaint(paintingData);
 
-    int optimalThreadNumber = (absolutePaintRect().width() * absolutePaintRect().height()) / s_minimalRectDimension;
-    if (optimalThreadNumber > 1) {
-        // Initialize parallel jobs
-        ParallelJobs<FillRegionParameters> parallelJobs(&FETurbulence::fillRegionWorker, optimalThreadNumber);
-
-        // Fill the parameter array
-        int i = parallelJobs.numberOfJobs();
-        if (i > 1) {
-            // Split the job into "stepY"-sized jobs but there a few jobs that need to be slightly larger since
-            // stepY * jobs < total size. These extras are handled by the remainder "jobsWithExtra".
-            const int stepY = absolutePaintRect().height() / i;
-            const int jobsWithExtra = absolutePaintRect().height() % i;
-
-            int startY = 0;
-            for (; i > 0; --i) {
-                FillRegionParameters& params = parallelJobs.parameter(i-1);
-                params.filter = this;
-                params.pixelArray = pixelArray;
-                params.paintingData = &paintingData;
-                params.startY = startY;
-                startY += i < jobsWithExtra ? stepY + 1 : stepY;
-                params.endY = startY;
-                params.baseFrequencyX = m_baseFrequencyX;
-                params.baseFrequencyY = m_baseFrequencyY;
-            }
-
-            // Execute parallel jobs
-            parallelJobs.execute();
-            return;
-        }
-    }
-
-    // Fallback to single threaded mode if there is no room for a new thread or the paint area is too small.
-    fillRegion(pixelArray, paintingData, 0, absolutePaintRect().height(), m_baseFrequencyX, m_baseFrequencyY);
+    FillRegionParameters parameters;
+    parameters.filter = this;
+    parameters.pixelArray = pixelArray;
+    parameters.paintingData = &paintingData;
+    parameters.baseFrequencyX = m_baseFrequencyX;
+    parameters.baseFrequencyY = m_baseFrequencyY;
+
+    // Rows are filled in chunks of about s_minimalRectDimension pixels, which the shared worker
+    // pool spreads over its threads. Paint areas of a single chunk are filled on this thread.
+    int rowsPerChunk = std::max(1, s_minimalRectDimension / absolutePaintRect().width());
+    parallelFor(absolutePaintRect().height(), rowsPerChunk, &FETurbulence::fillRegionWorker, &parameters);
 }
 
 SkShader* FETurbulence::createShader()
@@ -58,8 +58,6 @@ public:
     bool stitchTiles() const;
     bool setStitchTiles(bool);
 
-    static void fillRegionWorker(void*);
-
     virtual TextStream& externalRepresentation(TextStream&, int indention) const OVERRIDE;
 
 private:
@@ -98,20 +96,15 @@ private:
         int wrapY;
     };
 
-    template<typename Type>
-    friend class ParallelJobs;
-
     struct FillRegionParameters {
         FETurbulence* filter;
         Uint8ClampedArray* pixelArray;
         PaintingData* paintingData;
-        int startY;
-        int endY;
         float baseFrequencyX;
         float baseFrequencyY;
     };
 
-    static void fillRegionWorker(FillRegionParameters*);
+    static void fillRegionWorker(FillRegionParameters*, size_t startY, size_t endY);
 
     FETurbulence(Filter*, TurbulenceType, float, float, int, float, bool);
 
@@ -35,6 +35,7 @@
 #include "bindings/core/v8/V8Binding.h"
 #include "bindings/core/v8/V8GCController.h"
 #include "core/dom/Document.h"
+#include "core/dom/SharedInlineStyleSheetCache.h"
 #include "core/fetch/MemoryCache.h"
 #include "core/fetch/ResourceFetcher.h"
 #include "core/inspector/InspectorCounters.h"
@@ -85,6 +86,7 @@ void WebLeakDetectorImpl::collectGarbageAndGetDOMCounts(WebLocalFrame* frame)
 {
     WebEmbeddedWorkerImpl::terminateAll();
     memoryCache()->evictResources();
+    SharedInlineStyleSheetCache::instance().clear();
 
     {
         RefPtrWillBeRawPtr<Document> document = PassRefPtrWillBeRawPtr<Document>(frame->document());
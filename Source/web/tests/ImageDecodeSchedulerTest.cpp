@@ -0,0 +1,143 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "platform/graphics/ImageDecodeScheduler.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace blink;
+
+class TestImageDecodeScheduler : public ImageDecodeScheduler {
+public:
+    TestImageDecodeScheduler()
+        : m_workerThreadCount(8)
+        , m_postedTaskCount(0)
+    {
+    }
+
+    using ImageDecodeScheduler::DecodeRequest;
+    using ImageDecodeScheduler::enqueueDecode;
+    using ImageDecodeScheduler::takeNextRequest;
+
+    void setWorkerThreadCount(size_t count) { m_workerThreadCount = count; }
+    size_t postedTaskCount() const { return m_postedTaskCount; }
+
+private:
+    virtual size_t workerThreadCount() const OVERRIDE { return m_workerThreadCount; }
+    // The tests take the requests themselves instead of running decode tasks.
+    virtual void postDecodeTask() OVERRIDE { ++m_postedTaskCount; }
+
+    size_t m_workerThreadCount;
+    size_t m_postedTaskCount;
+};
+
+// Each bitmap gets its own pixel ref and generation ID.
+static SkBitmap createBitmap()
+{
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(1, 1);
+    return bitmap;
+}
+
+static uint32_t takeNextGenerationID(TestImageDecodeScheduler& scheduler)
+{
+    TestImageDecodeScheduler::DecodeRequest request;
+    if (!scheduler.takeNextRequest(request))
+        return 0;
+    return request.bitmap.getGenerationID();
+}
+
+TEST(ImageDecodeSchedulerTest, NearestIsDecodedFirst)
+{
+    TestImageDecodeScheduler scheduler;
+    SkBitmap far = createBitmap();
+    SkBitmap near = createBitmap();
+    SkBitmap middle = createBitmap();
+    scheduler.enqueueDecode(far, 300);
+    scheduler.enqueueDecode(near, 100);
+    scheduler.enqueueDecode(middle, 200);
+
+    EXPECT_EQ(near.getGenerationID(), takeNextGenerationID(scheduler));
+    EXPECT_EQ(middle.getGenerationID(), takeNextGenerationID(scheduler));
+    EXPECT_EQ(far.getGenerationID(), takeNextGenerationID(scheduler));
+}
+
+TEST(ImageDecodeSchedulerTest, EqualDistancesAreDecodedInScheduleOrder)
+{
+    TestImageDecodeScheduler scheduler;
+    SkBitmap first = createBitmap();
+    SkBitmap second = createBitmap();
+    scheduler.enqueueDecode(first, 100);
+    scheduler.enqueueDecode(second, 100);
+
+    EXPECT_EQ(first.getGenerationID(), takeNextGenerationID(scheduler));
+    EXPECT_EQ(second.getGenerationID(), takeNextGenerationID(scheduler));
+}
+
+TEST(ImageDecodeSchedulerTest, NearerRequestSupersedesWaitingRequest)
+{
+    TestImageDecodeScheduler scheduler;
+    SkBitmap image = createBitmap();
+    SkBitmap other = createBitmap();
+    scheduler.enqueueDecode(image, 300);
+    scheduler.enqueueDecode(other, 200);
+    scheduler.enqueueDecode(image, 100);
+    // Scheduling it again further away doesn't move it back.
+    scheduler.enqueueDecode(image, 400);
+
+    TestImageDecodeScheduler::DecodeRequest request;
+    ASSERT_TRUE(scheduler.takeNextRequest(request));
+    EXPECT_EQ(image.getGenerationID(), request.bitmap.getGenerationID());
+    EXPECT_EQ(100, request.distanceFromViewport);
+    EXPECT_EQ(other.getGenerationID(), takeNextGenerationID(scheduler));
+
+    // The superseded request is skipped, so the image is decoded once.
+    EXPECT_FALSE(scheduler.takeNextRequest(request));
+}
+
+TEST(ImageDecodeSchedulerTest, RunningTaskCountIsCapped)
+{
+    TestImageDecodeScheduler scheduler;
+    Vector<SkBitmap> bitmaps;
+    for (size_t i = 0; i < 10; ++i) {
+        bitmaps.append(createBitmap());
+        scheduler.enqueueDecode(bitmaps.last(), i);
+    }
+    EXPECT_EQ(4u, scheduler.postedTaskCount());
+
+    // Every task takes requests until there are none left, and then stops.
+    for (size_t i = 0; i < bitmaps.size(); ++i)
+        EXPECT_EQ(bitmaps[i].getGenerationID(), takeNextGenerationID(scheduler));
+    for (size_t i = 0; i < 4; ++i)
+        EXPECT_FALSE(takeNextGenerationID(scheduler));
+
+    // With all tasks stopped, a new request starts a new one.
+    SkBitmap bitmap = createBitmap();
+    scheduler.enqueueDecode(bitmap, 0);
+    EXPECT_EQ(5u, scheduler.postedTaskCount());
+    EXPECT_EQ(bitmap.getGenerationID(), takeNextGenerationID(scheduler));
+    EXPECT_FALSE(takeNextGenerationID(scheduler));
+}
+
+TEST(ImageDecodeSchedulerTest, RunningTaskCountIsCappedByWorkerThreads)
+{
+    TestImageDecodeScheduler scheduler;
+    scheduler.setWorkerThreadCount(2);
+    Vector<SkBitmap> bitmaps;
+    for (size_t i = 0; i < 10; ++i) {
+        bitmaps.append(createBitmap());
+        scheduler.enqueueDecode(bitmaps.last(), i);
+    }
+    EXPECT_EQ(2u, scheduler.postedTaskCount());
+
+    for (size_t i = 0; i < bitmaps.size(); ++i)
+        takeNextGenerationID(scheduler);
+    for (size_t i = 0; i < 2; ++i)
+        EXPECT_FALSE(takeNextGenerationID(scheduler));
+}
+
+} // namespace
@@ -0,0 +1,95 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "config.h"
+#include "platform/ParallelWorkerPool.h"
+
+#include "wtf/Atomics.h"
+#include "wtf/Vector.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace blink;
+
+struct CountingParameters {
+    Vector<int> visitCounts;
+    int rangeCount;
+};
+
+static void countVisits(CountingParameters* parameters, size_t begin, size_t end)
+{
+    EXPECT_LT(begin, end);
+    EXPECT_LE(end, parameters->visitCounts.size());
+    for (size_t i = begin; i < end; ++i)
+        atomicIncrement(&parameters->visitCounts[i]);
+    atomicIncrement(&parameters->rangeCount);
+}
+
+static void expectVisitedOnce(const CountingParameters& parameters)
+{
+    for (size_t i = 0; i < parameters.visitCounts.size(); ++i)
+        EXPECT_EQ(1, parameters.visitCounts[i]) << "item " << i;
+}
+
+TEST(ParallelWorkerPoolTest, VisitsEveryItemOnce)
+{
+    const size_t counts[] = { 1, 2, 7, 100, 1000, 12345 };
+    const size_t grainSizes[] = { 0, 1, 3, 64, 100000 };
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(counts); ++i) {
+        for (size_t j = 0; j < WTF_ARRAY_LENGTH(grainSizes); ++j) {
+            CountingParameters parameters;
+            parameters.visitCounts.resize(counts[i]);
+            parameters.visitCounts.fill(0);
+            parameters.rangeCount = 0;
+            parallelFor(counts[i], grainSizes[j], &countVisits, &parameters);
+            expectVisitedOnce(parameters);
+        }
+    }
+}
+
+TEST(ParallelWorkerPoolTest, SingleChunkRunsAsOneRange)
+{
+    CountingParameters parameters;
+    parameters.visitCounts.resize(50);
+    parameters.visitCounts.fill(0);
+    parameters.rangeCount = 0;
+    parallelFor(50, 50, &countVisits, &parameters);
+    expectVisitedOnce(parameters);
+    EXPECT_EQ(1, parameters.rangeCount);
+}
+
+TEST(ParallelWorkerPoolTest, EmptyRangeDoesNothing)
+{
+    CountingParameters parameters;
+    parameters.rangeCount = 0;
+    parallelFor(0, 1, &countVisits, &parameters);
+    EXPECT_EQ(0, parameters.rangeCount);
+}
+
+struct NestedParameters {
+    Vector<CountingParameters> inner;
+};
+
+static void runNested(NestedParameters* parameters, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i)
+        parallelFor(parameters->inner[i].visitCounts.size(), 4, &countVisits, &parameters->inner[i]);
+}
+
+TEST(ParallelWorkerPoolTest, NestedCallsComplete)
+{
+    NestedParameters parameters;
+    parameters.inner.resize(16);
+    for (size_t i = 0; i < parameters.inner.size(); ++i) {
+        parameters.inner[i].visitCounts.resize(100 + i);
+        parameters.inner[i].visitCounts.fill(0);
+        parameters.inner[i].rangeCount = 0;
+    }
+    parallelFor(parameters.inner.size(), 1, &runNested, &parameters);
+    for (size_t i = 0; i < parameters.inner.size(); ++i)
+        expectVisitedOnce(parameters.inner[i]);
+}
+
+} // namespace